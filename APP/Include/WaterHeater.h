@@ -11,4 +11,36 @@
 #ifndef WATER_HEATER_H_
 #define WATER_HEATER_H_
 
+#ifdef HW_HOST
+/* The Largest Number Of Readings The Host Tools Can Tune */
+#define WATER_HEATER_MAX_NUMBER_OF_READINGS     64
+
+typedef struct
+{
+    /* The Setpoint Step And The Band Around The Setpoint Where No Element Is Switched On */
+    uint8_t changeRate;
+    /* The Number Of Readings Averaged (1 .. WATER_HEATER_MAX_NUMBER_OF_READINGS) */
+    uint8_t numberOfReadings;
+    /* Turns Off Both Elements Inside The Band (ADD_WATER_TEMPRATURE_CONTROL_FEATURE) */
+    uint8_t controlFeature;
+} waterHeaterTuning_t;
+
+/**
+ * @brief Gets the configured tuning of the application
+ * 
+ * @param tuning The tuning
+ */
+extern void WaterHeater_GetDefaultTuning(waterHeaterTuning_t* tuning);
+
+/**
+ * @brief Sets the tuning of this instance of the application, it must be called before the scheduler starts
+ * 
+ * @param tuning The tuning
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType WaterHeater_SetTuning(const waterHeaterTuning_t* tuning);
+#endif
+
 #endif
\ No newline at end of file
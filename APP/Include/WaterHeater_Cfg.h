@@ -15,4 +15,28 @@
  * Temprature Difference Is Less Than 5 Degrees */
 #define ADD_WATER_TEMPRATURE_CONTROL_FEATURE
 
+/* A Diagnostic Display Of The CPU Load, The Up Button Shows And Hides It While The Heater Is Off,
+ * It Needs SCHED_CPU_LOAD */
+#define WATER_HEATER_CPU_LOAD_DISPLAY
+
+/* The Filter Of The Temprature Readings, FILTER_MODE_AVERAGE Averages The Last Readings With A Running Sum And
+ * FILTER_MODE_EMA Weights Every New Reading By 1 / 2^WATER_HEATER_FILTER_EMA_SHIFT Without A Window */
+#define WATER_HEATER_FILTER_MODE                            FILTER_MODE_AVERAGE
+#define WATER_HEATER_FILTER_EMA_SHIFT                       3
+
+/* The Control Hysteresis In Tenths Of A Degree, An Element Switches On When The Filtered Temprature Leaves The Band
+ * Of The Change Rate Around The Set Temprature And Keeps Running Until It Is Within This Margin Of The Set Temprature,
+ * So The Deadband Between Switching On And Off Is The Band Minus The Margin, 0 Runs The Element Up To The Set
+ * Temprature, It Must Be Below One Degree (The Smallest Band) */
+#define WATER_HEATER_OFF_MARGIN_TENTHS                      0
+
+/* Tasks Periodicity, The Scheduler Table Converts Them To Ticks At Compile Time */
+#define WATER_HEATER_INIT_TASK_PERIODICITY                  5
+#define WATER_HEATER_MAIN_TASK_PERIODICITY                  25
+/* The Save Job Is Scheduled At Most Once Per Main Task Run */
+#define WATER_HEATER_SAVE_TASK_PERIODICITY                  25
+/* The Set Temprature Is Saved This Long After Its Last Change, A Run Of Presses Takes One Record,
+ * It Must Fit The One Shot Delay Of The Scheduler (SCHED_MAX_TICKS Ticks) */
+#define WATER_HEATER_SAVE_DELAY_MS                          1000
+
 #endif
\ No newline at end of file
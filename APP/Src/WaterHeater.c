@@ -14,20 +14,31 @@
 #include "Element.h"
 #include "Led.h"
 #include "SSeg.h"
+#include "Int.h"
 #include "Adc.h"
+#include "AdcSeq.h"
+#include "I2c.h"
 #include "Eeprom.h"
+#include "Settings.h"
+#include "Wdt.h"
 #include "Sched.h"
 #include "WaterHeater.h"
 #include "WaterHeater_Cfg.h"
+#include "Filter.h"
+#include "Cal.h"
+#include "Hw.h"
 
 /* The Number Of Readings (Configurable) */
-#define WATER_HEATER_NUMBER_OF_READINGS       10
-
-/* The Address In The EEPROM (Configurable) */
-#define WATER_HEATER_TEMP_DATA_ADDRESS        (Eeprom_Address_t)0x0000
-/* The Initial Temprature */
-#define WATER_HEATER_INITIAL_TEMP             60
+#define WATER_HEATER_DEFAULT_NUMBER_OF_READINGS       10
 
+/* The Watchdog Reset Log, The Number Of Resets Then The Handle Of The Last Task That Missed Its Deadline */
+#define WATER_HEATER_RESET_LOG_ADDRESS        (Eeprom_Address_t)0x0010
+#define WATER_HEATER_RESET_LOG_COUNT          0
+#define WATER_HEATER_RESET_LOG_TASK           1
+#define WATER_HEATER_RESET_LOG_SIZE           2
+/* The Erased EEPROM Reads As No Resets, The Count Stops Below It */
+#define WATER_HEATER_RESET_COUNT_ERASED       0xFF
+#define WATER_HEATER_RESET_COUNT_MAX          0xFE
 /* The Water Heater Modes */
 #define WATER_HEATER_OFF_MODE                   0
 #define WATER_HEATER_TEMPRATURE_SETTING_MODE    1
@@ -36,7 +47,27 @@
 /* The Water Heater Temprature Settings */
 #define WATER_HEATER_LOWER_LIMIT                35
 #define WATER_HEATER_UPPER_LIMIT                75
-#define WATER_HEATER_CHANGE_RATE                5
+#define WATER_HEATER_DEFAULT_CHANGE_RATE        5
+
+/* The Temprature Control Feature */
+#ifdef ADD_WATER_TEMPRATURE_CONTROL_FEATURE
+#define WATER_HEATER_DEFAULT_CONTROL_FEATURE    1
+#else
+#define WATER_HEATER_DEFAULT_CONTROL_FEATURE    0
+#endif
+
+/* The Host Tools Tune These Per Instance, The Target Uses The Configured Values */
+#ifdef HW_HOST
+#define WATER_HEATER_NUMBER_OF_READINGS         WaterHeater_tuning.numberOfReadings
+#define WATER_HEATER_CHANGE_RATE                WaterHeater_tuning.changeRate
+#define WATER_HEATER_CONTROL_FEATURE            WaterHeater_tuning.controlFeature
+#define WATER_HEATER_READINGS_SIZE              WATER_HEATER_MAX_NUMBER_OF_READINGS
+#else
+#define WATER_HEATER_NUMBER_OF_READINGS         WATER_HEATER_DEFAULT_NUMBER_OF_READINGS
+#define WATER_HEATER_CHANGE_RATE                WATER_HEATER_DEFAULT_CHANGE_RATE
+#define WATER_HEATER_CONTROL_FEATURE            WATER_HEATER_DEFAULT_CONTROL_FEATURE
+#define WATER_HEATER_READINGS_SIZE              WATER_HEATER_DEFAULT_NUMBER_OF_READINGS
+#endif
 
 /* The Water Heater Running Elements States */
 #define WATER_HEATER_HEATING_ELEMENT_RUNNING                0
@@ -51,44 +82,79 @@
 #define WATER_HEATER_5_SEC                                  10
 
 #define WATER_HEATER_COUNTER_RESET_VALUE                    0
-#define WATER_HEATER_INDEX_RESET_VALUE                      0
-#define WATER_HEATER_TEMPRATURE_SENSOR_FACTOR               2
+/* The Readings Are In Tenths Of A Degree */
+#define WATER_HEATER_TENTHS_PER_DEGREE                      10
 
 /* The Temprature Getting Macros */
 #define WATER_HEATER_GET_ONES(data)                         (data%10)
 #define WATER_HEATER_GET_TENS(data)                         ((data/10)%10)
 
-/* Tasks Periodicity */
-#define WATER_HEATER_INIT_TASK_PERIODICITY                  5
-#define WATER_HEATER_MAIN_TASK_PERIODICITY                  25
+/* The CPU Load Display Needs The Load Meter Of The Scheduler */
+#if defined(WATER_HEATER_CPU_LOAD_DISPLAY) && SCHED_CPU_LOAD == STD_ON
+#define WATER_HEATER_LOAD_DISPLAY                           STD_ON
+#else
+#define WATER_HEATER_LOAD_DISPLAY                           STD_OFF
+#endif
+/* The Load Is Shown In Percent On Two Digits */
+#define WATER_HEATER_LOAD_DISPLAY_MAX                       99
+
+/* The Save Job Runs In The Scan After The Configured Tasks */
+#define WATER_HEATER_SAVE_TASK_PRIORITY                     0
+
+STD_STATIC_ASSERT(WATER_HEATER_OFF_MARGIN_TENTHS < WATER_HEATER_TENTHS_PER_DEGREE, WaterHeater_offMarginCheck);
+STD_STATIC_ASSERT(SCHED_MS_TO_TICKS(WATER_HEATER_SAVE_DELAY_MS) < SCHED_MAX_TICKS, WaterHeater_saveDelayCheck);
 
 /* Static Functions Declaration */
 static void WaterHeater_Init(void);
 static void WaterHeater_Runnable(void);
+static void WaterHeater_Save(void);
+static void WaterHeater_Changed(void);
 static Std_ReturnType WaterHeater_CheckSwitches(void);
 static Std_ReturnType WaterHeater_UpdateCfgModeCounter(void);
 static Std_ReturnType WaterHeater_AddReading(void);
 static Std_ReturnType WaterHeater_TakeAction(void);
 static Std_ReturnType WaterHeater_Blink(void);
+#if SCHED_WATCHDOG == STD_ON
+static void WaterHeater_LogReset(void);
+#endif
+#if WATER_HEATER_LOAD_DISPLAY == STD_ON
+static void WaterHeater_ShowLoad(void);
+#endif
 
 /* Water Heater Defined Data Types */
 typedef uint8_t temperature_t;
 typedef uint8_t heaterMode_t;
 typedef uint8_t runningElement_t;
 typedef uint8_t secCounter_t;
-typedef temperature_t tempratureReadings_t[WATER_HEATER_NUMBER_OF_READINGS];
+typedef filterSample_t tempratureReadings_t[WATER_HEATER_READINGS_SIZE];
 
 /* Water Heater Data Elements */
-static volatile temperature_t WaterHeater_temperature;
-static volatile heaterMode_t WaterHeater_mode;
-static volatile tempratureReadings_t WaterHeater_readings;
-static volatile secCounter_t WaterHeater_settingModeCounter;
-static volatile runningElement_t WaterHeater_runningElement;
+static HW_INSTANCE volatile temperature_t WaterHeater_temperature;
+static HW_INSTANCE volatile heaterMode_t WaterHeater_mode;
+#if WATER_HEATER_FILTER_MODE != FILTER_MODE_EMA
+static HW_INSTANCE tempratureReadings_t WaterHeater_readings;
+#endif
+/* The Filter Of The Readings, The Window Is WaterHeater_readings In The Average Mode */
+static HW_INSTANCE filter_t WaterHeater_filter;
+static HW_INSTANCE volatile secCounter_t WaterHeater_settingModeCounter;
+static HW_INSTANCE volatile runningElement_t WaterHeater_runningElement;
+/* The Set Temprature Differs From The One In The Settings */
+static HW_INSTANCE volatile uint8_t WaterHeater_dirty;
+static HW_INSTANCE schedHandle_t WaterHeater_saveHandle;
+#if WATER_HEATER_LOAD_DISPLAY == STD_ON
+/* The Display Shows The CPU Load Instead Of Being Off, It Is Only Set In The Off Mode */
+static HW_INSTANCE volatile uint8_t WaterHeater_diagnostic;
+#endif
+#ifdef HW_HOST
+static HW_INSTANCE waterHeaterTuning_t WaterHeater_tuning = {WATER_HEATER_DEFAULT_CHANGE_RATE, WATER_HEATER_DEFAULT_NUMBER_OF_READINGS, WATER_HEATER_DEFAULT_CONTROL_FEATURE};
+#endif
 
 /* The init task will run only one time then it will be suspended */
 const task_t WaterHeater_InitTask = {WaterHeater_Init, WATER_HEATER_INIT_TASK_PERIODICITY};
 /* The Least Period Task Is To Check For The Switches And This May Need 25 Milli Seconds */
 const task_t WaterHeater_Task = {WaterHeater_Runnable, WATER_HEATER_MAIN_TASK_PERIODICITY};
+/* The One Shot Job That Saves The Set Temprature, It Only Runs When The Temprature Is Dirty */
+const task_t WaterHeater_SaveTask = {WaterHeater_Save, WATER_HEATER_SAVE_TASK_PERIODICITY};
 
 /**
  * @brief The Initialization Runnable, Runs One Time And Then Suspends Itself
@@ -96,6 +162,8 @@ const task_t WaterHeater_Task = {WaterHeater_Runnable, WATER_HEATER_MAIN_TASK_PE
  */
 static void WaterHeater_Init(void)
 {
+    /* The Saved Temprature */
+    settingsValue_t temperature;
     /* Hardware Initializations */
     Gpio_SetPortBPullup(GPIO_PORTB_PULLUP_EN);
     Led_Init();
@@ -106,19 +174,99 @@ static void WaterHeater_Init(void)
     Switch_Init();
     SSeg_Init();
     SSeg_SetDisplay(SSEG_OFF);
-    Adc_Init();
-    Adc_SelectChannel(ADC_CH_2);
+    AdcSeq_Init();
+#if WATER_HEATER_FILTER_MODE == FILTER_MODE_EMA
+    Filter_Init(&WaterHeater_filter, FILTER_MODE_EMA, NULL, WATER_HEATER_FILTER_EMA_SHIFT);
+#else
+    Filter_Init(&WaterHeater_filter, FILTER_MODE_AVERAGE, WaterHeater_readings, WATER_HEATER_NUMBER_OF_READINGS);
+#endif
     Eeprom_Init();
-    /* Writing The Initial Temprature To The EEPROM */
-    Eeprom_WriteByte(WATER_HEATER_TEMP_DATA_ADDRESS, WATER_HEATER_INITIAL_TEMP);
+    /* The Trims Of The Unit Are In The EEPROM */
+    Cal_Init();
+#if SCHED_WATCHDOG == STD_ON
+    WaterHeater_LogReset();
+#endif
+    /* The Last Saved Settings, Or Their Initial Values */
+    Settings_Init();
     /* Initializing The Data Elements */
     WaterHeater_runningElement = WATER_HEATER_NO_ELEMENT_RUNNING;
-    WaterHeater_temperature = WATER_HEATER_INITIAL_TEMP;
+    Settings_Get(WATER_HEATER_SETPOINT_SETTING, &temperature);
+    WaterHeater_temperature = temperature;
     WaterHeater_mode = WATER_HEATER_OFF_MODE;
+    WaterHeater_dirty = 0;
+    /* The Save Job Waits Suspended Until A Setting Is Dirty */
+    Sched_CreateTask(&WaterHeater_SaveTask, WATER_HEATER_SAVE_TASK_PRIORITY, &WaterHeater_saveHandle);
     /* Suspend The Init Task */
     Sched_SuspendTask();
 }
 
+#if SCHED_WATCHDOG == STD_ON
+/**
+ * @brief Logs A Watchdog Reset And The Task That Missed Its Deadline In The EEPROM
+ * 
+ */
+static void WaterHeater_LogReset(void)
+{
+    schedResetInfo_t resetInfo;
+    uint8_t log[WATER_HEATER_RESET_LOG_SIZE];
+    Sched_GetResetInfo(&resetInfo);
+    if(WDT_RESET_WATCHDOG == resetInfo.cause && Eeprom_ReadBlock(WATER_HEATER_RESET_LOG_ADDRESS, log, WATER_HEATER_RESET_LOG_SIZE) == E_OK)
+    {
+        if(WATER_HEATER_RESET_COUNT_ERASED == log[WATER_HEATER_RESET_LOG_COUNT])
+        {
+            log[WATER_HEATER_RESET_LOG_COUNT] = 1;
+        }
+        else if(log[WATER_HEATER_RESET_LOG_COUNT] < WATER_HEATER_RESET_COUNT_MAX)
+        {
+            log[WATER_HEATER_RESET_LOG_COUNT]++;
+        }
+        else
+        {
+            /* Empty Else Statement To Satisfy The Misra Rules */
+        }
+        log[WATER_HEATER_RESET_LOG_TASK] = resetInfo.task;
+        /* The Count And The Task In One Write Cycle */
+        Eeprom_WritePage(WATER_HEATER_RESET_LOG_ADDRESS, log, WATER_HEATER_RESET_LOG_SIZE);
+    }
+    else
+    {
+        /* Empty Else Statement To Satisfy The Misra Rules */
+    }
+}
+#endif
+
+#if WATER_HEATER_LOAD_DISPLAY == STD_ON
+/**
+ * @brief Shows The CPU Load Of The Last Window In Percent When The Diagnostic Display Is On
+ * 
+ */
+static void WaterHeater_ShowLoad(void)
+{
+    schedCpuLoad_t load;
+    uint16_t percent;
+    if(WaterHeater_diagnostic)
+    {
+        Sched_GetCpuLoad(&load);
+        /* Round To The Nearest Percent */
+        percent = (load.loadPermille + 5) / 10;
+        if(percent > WATER_HEATER_LOAD_DISPLAY_MAX)
+        {
+            percent = WATER_HEATER_LOAD_DISPLAY_MAX;
+        }
+        else
+        {
+            /* Empty Else Statement To Satisfy The Misra Rules */
+        }
+        SSeg_SetNum(SSEG_ONES,WATER_HEATER_GET_ONES(percent));
+        SSeg_SetNum(SSEG_TENS,WATER_HEATER_GET_TENS(percent));
+    }
+    else
+    {
+        /* Empty Else Statement To Satisfy The Misra Rules */
+    }
+}
+#endif
+
 /**
  * @brief The Main Runnable For The Water Heater Application
  * Application Is Designed In One Task For The Modularity Of The Application
@@ -128,7 +276,9 @@ static void WaterHeater_Init(void)
 static void WaterHeater_Runnable(void)
 {
     /* The Counter To Toggle Between States (Small Tasks) */
-    static uint16_t taskCounter;
+    static HW_INSTANCE uint16_t taskCounter;
+    /* A Transaction That Hung Since The Last Run Is Aborted So The Save Cannot Block The Bus */
+    I2c_CheckTimeout();
     /* The Switches Checking */
     WaterHeater_CheckSwitches();
     /* 100 Milli Tasks */
@@ -149,6 +299,10 @@ static void WaterHeater_Runnable(void)
         /* Toggling Tasks Comes Every 500 Milli So That A Complete Blink Happens In A Second */
         WaterHeater_UpdateCfgModeCounter();
         WaterHeater_Blink();
+#if WATER_HEATER_LOAD_DISPLAY == STD_ON
+        /* The Load Meter Closes A Window Every SCHED_LOAD_WINDOW_MS */
+        WaterHeater_ShowLoad();
+#endif
         taskCounter = WATER_HEATER_COUNTER_RESET_VALUE;
     }
     else
@@ -158,6 +312,39 @@ static void WaterHeater_Runnable(void)
     taskCounter++;
 }
 
+/**
+ * @brief The Save Runnable, Runs Once When Scheduled And Commits The Set Temprature To The Settings
+ *        The Settings Skip A Temprature That Came Back To The Saved One, It Does Not Wait For The Bus,
+ *        It Runs Again WATER_HEATER_SAVE_DELAY_MS Later Until The Record Is Written, So A Record That
+ *        Could Not Be Queued Or Failed In The Interrupt Is Written Again
+ * 
+ */
+static void WaterHeater_Save(void)
+{
+    WaterHeater_dirty = 0;
+    Settings_Set(WATER_HEATER_SETPOINT_SETTING, WaterHeater_temperature);
+    Settings_Commit();
+    if(Settings_IsDirty())
+    {
+        Sched_ScheduleOnce(WaterHeater_saveHandle, WATER_HEATER_SAVE_DELAY_MS);
+    }
+    else
+    {
+        /* Empty Else Statement To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Marks The Set Temprature Dirty And Delays The Save Job, So It Runs WATER_HEATER_SAVE_DELAY_MS After The Last Change
+ *        Without A Save Job The Temprature Is Saved When The Heater Is Turned Off
+ * 
+ */
+static void WaterHeater_Changed(void)
+{
+    WaterHeater_dirty = 1;
+    Sched_ScheduleOnce(WaterHeater_saveHandle, WATER_HEATER_SAVE_DELAY_MS);
+}
+
 
 /**
  * @brief Checking The State Of The Switches
@@ -169,7 +356,9 @@ static void WaterHeater_Runnable(void)
 static Std_ReturnType WaterHeater_CheckSwitches(void)
 {
     /* Switches States */
-    static Switch_State_t onOffState = SWITCH_NOT_PRESSED, onOffPrevState, upState = SWITCH_NOT_PRESSED, upPrevState, downState = SWITCH_NOT_PRESSED, downPrevState;
+    static HW_INSTANCE Switch_State_t onOffState = SWITCH_NOT_PRESSED, onOffPrevState, upState = SWITCH_NOT_PRESSED, upPrevState, downState = SWITCH_NOT_PRESSED, downPrevState;
+    /* The Temprature Loaded From The Settings */
+    settingsValue_t temperature;
     /* Save The Previous States */
     onOffPrevState = onOffState;
     upPrevState = upState;
@@ -188,8 +377,19 @@ static Std_ReturnType WaterHeater_CheckSwitches(void)
         {
             /* Change Mode To Running Mode */
             WaterHeater_mode = WATER_HEATER_RUNNING_MODE;
+#if WATER_HEATER_LOAD_DISPLAY == STD_ON
+            WaterHeater_diagnostic = 0;
+#endif
             /* Load The Last Saved Temprature */
-            Eeprom_ReadByte(WATER_HEATER_TEMP_DATA_ADDRESS, &WaterHeater_temperature);
+            if(Settings_Get(WATER_HEATER_SETPOINT_SETTING, &temperature) == E_OK)
+            {
+                WaterHeater_temperature = temperature;
+                WaterHeater_dirty = 0;
+            }
+            else
+            {
+                /* Empty Else Statement To Satisfy The Misra Rules */
+            }
         }
         else
         {
@@ -199,8 +399,15 @@ static Std_ReturnType WaterHeater_CheckSwitches(void)
             Element_SetElementOff(WATER_HEATER_COOLING_ELEMENT);
             Led_SetLedOff(WATER_HEATER_HEATING_LED);
             SSeg_SetDisplay(SSEG_OFF);
-            /* Save The Last Set Temprature */
-            Eeprom_WriteByte(WATER_HEATER_TEMP_DATA_ADDRESS, WaterHeater_temperature);
+            /* Save The Last Set Temprature Now Outside This Task If It Changed, Or Here If There Is No Save Job */
+            if(WaterHeater_dirty && Sched_ScheduleOnce(WaterHeater_saveHandle, 0) != E_OK)
+            {
+                WaterHeater_Save();
+            }
+            else
+            {
+                /* Empty Else Statement To Satisfy The Misra Rules */
+            }
         }
     }
     /* When Switch Is Released */
@@ -227,11 +434,23 @@ static Std_ReturnType WaterHeater_CheckSwitches(void)
                     /* Empty Else Statement To Satisfy The Misra Rules */
                 }
                 WaterHeater_settingModeCounter = WATER_HEATER_COUNTER_RESET_VALUE;
+                WaterHeater_Changed();
                 break;
+#if WATER_HEATER_LOAD_DISPLAY == STD_ON
+            case WATER_HEATER_OFF_MODE:
+                /* Show Or Hide The CPU Load While The Heater Is Off */
+                WaterHeater_diagnostic = !WaterHeater_diagnostic;
+                SSeg_SetDisplay(WaterHeater_diagnostic ? SSEG_ON : SSEG_OFF);
+                break;
+#endif
         }
         /* Display The Set Temprature */
         SSeg_SetNum(SSEG_ONES,WATER_HEATER_GET_ONES(WaterHeater_temperature));
         SSeg_SetNum(SSEG_TENS,WATER_HEATER_GET_TENS(WaterHeater_temperature));
+#if WATER_HEATER_LOAD_DISPLAY == STD_ON
+        /* Or The CPU Load In The Diagnostic Display */
+        WaterHeater_ShowLoad();
+#endif
     }
     /* When Switch Is Released */
     /* Down State */
@@ -257,6 +476,7 @@ static Std_ReturnType WaterHeater_CheckSwitches(void)
                     /* Empty Else Statement To Satisfy The Misra Rules */
                 }
                 WaterHeater_settingModeCounter = WATER_HEATER_COUNTER_RESET_VALUE;
+                WaterHeater_Changed();
                 break;
         }
         /* Display The Set Temprature */
@@ -301,38 +521,40 @@ static Std_ReturnType WaterHeater_UpdateCfgModeCounter(void)
  * 
  *  @returns: A status
  *                 E_OK : if the function is executed correctly
- *                 E_NOT_OK : if the function is not executed correctly
+ *                 E_NOT_OK : if the sensor has no sample yet
  */
 static Std_ReturnType WaterHeater_AddReading(void)
 {
-    static uint8_t readingIndex;
-    Adc_Value_t reading; 
-    /* Gets The Analog Value */
-    Adc_GetValue(&reading);
-    /* Calculate The Temperature */
-    reading/=WATER_HEATER_TEMPRATURE_SENSOR_FACTOR;
-    /* Adds The Reading */
-    WaterHeater_readings[readingIndex++] = reading;
-    if(readingIndex == WATER_HEATER_NUMBER_OF_READINGS)
+    Adc_Value_t counts;
+    calTemperature_t tenths;
+    uint16_t reading;
+    /* Takes The Filtered Sample Of The Sequencer Without The Spikes, The Readings Stay As They Are Without One */
+    Std_ReturnType error = AdcSeq_GetFiltered(WATER_HEATER_TANK_TOP_SENSOR, &counts);
+    if(error == E_OK)
     {
-        readingIndex = WATER_HEATER_INDEX_RESET_VALUE;
-    }
-    else
-    {
-        /* Empty Else Statement To Satisfy The Misra Rules */
-    }
-    /* Display the current readig in the running mode */
-    if(WaterHeater_mode == WATER_HEATER_RUNNING_MODE)
-    {
-        SSeg_SetNum(SSEG_ONES,WATER_HEATER_GET_ONES(reading));
-        SSeg_SetNum(SSEG_TENS,WATER_HEATER_GET_TENS(reading));
-        SSeg_SetDisplay(SSEG_ON);
+        /* The Sensor Table And The Trims Give Tenths Of A Degree, The Water Is Not Below 0 */
+        Cal_Convert(WATER_HEATER_TANK_TOP_SENSOR, counts, &tenths);
+        reading = (tenths > 0) ? (uint16_t)tenths : 0;
+        Filter_Add(&WaterHeater_filter, reading);
+        /* Calculate The Temperature Rounded To The Nearest Degree */
+        reading = (reading + WATER_HEATER_TENTHS_PER_DEGREE / 2) / WATER_HEATER_TENTHS_PER_DEGREE;
+        /* Display the current readig in the running mode */
+        if(WaterHeater_mode == WATER_HEATER_RUNNING_MODE)
+        {
+            SSeg_SetNum(SSEG_ONES,WATER_HEATER_GET_ONES(reading));
+            SSeg_SetNum(SSEG_TENS,WATER_HEATER_GET_TENS(reading));
+            SSeg_SetDisplay(SSEG_ON);
+        }
+        else
+        {
+            /* Empty Else Statement To Satisfy The Misra Rules */
+        }
     }
     else
     {
         /* Empty Else Statement To Satisfy The Misra Rules */
     }
-    return E_OK;
+    return error;
 }
 /**
  * @brief Takes Action For The Elements And The Led
@@ -343,21 +565,18 @@ static Std_ReturnType WaterHeater_AddReading(void)
  */
 static Std_ReturnType WaterHeater_TakeAction(void)
 {
-    uint8_t readingIndex;
-    uint16_t readingsTotal;
-    float32_t readingsAvg;
-    /* If The Water Heater Is On */
-    if(WaterHeater_mode != WATER_HEATER_OFF_MODE)
+    uint16_t readingsAvg;
+    /* The Set Temprature And The Band In Tenths Of A Degree */
+    uint16_t setTenths = (uint16_t)WaterHeater_temperature * WATER_HEATER_TENTHS_PER_DEGREE;
+    uint16_t bandTenths = (uint16_t)WATER_HEATER_CHANGE_RATE * WATER_HEATER_TENTHS_PER_DEGREE;
+    /* If The Water Heater Is On And There Are Readings */
+    if(WaterHeater_mode != WATER_HEATER_OFF_MODE &&
+       Filter_GetValue(&WaterHeater_filter, 1, 1, &readingsAvg) == E_OK)
     {
-        /* Calculate the average */
-        readingsTotal = 0;
-        for(readingIndex=0; readingIndex<WATER_HEATER_NUMBER_OF_READINGS; readingIndex++)
-        {
-            readingsTotal += (uint16_t)WaterHeater_readings[readingIndex];
-        }
-        readingsAvg = (float32_t)readingsTotal/(float32_t)WATER_HEATER_NUMBER_OF_READINGS;
-        /* Check For The Low Temperature Case */
-        if(readingsAvg - (float32_t)WaterHeater_temperature > (float32_t)WATER_HEATER_CHANGE_RATE)
+        /* Check For The Low Temperature Case, A Running Element Keeps Running Until It Is Within The Off Margin */
+        if(readingsAvg > setTenths + bandTenths ||
+           (WaterHeater_runningElement == WATER_HEATER_COOLING_ELEMENT_RUNNING &&
+            readingsAvg > setTenths + WATER_HEATER_OFF_MARGIN_TENTHS))
         {
             Element_SetElementOn(WATER_HEATER_COOLING_ELEMENT);
             Element_SetElementOff(WATER_HEATER_HEATING_ELEMENT);
@@ -365,7 +584,9 @@ static Std_ReturnType WaterHeater_TakeAction(void)
             WaterHeater_runningElement = WATER_HEATER_COOLING_ELEMENT_RUNNING;
         }
         /* Check For The High Temperature Case */
-        else if((float32_t)WaterHeater_temperature - readingsAvg > (float32_t)WATER_HEATER_CHANGE_RATE)
+        else if(readingsAvg + bandTenths < setTenths ||
+                (WaterHeater_runningElement == WATER_HEATER_HEATING_ELEMENT_RUNNING &&
+                 readingsAvg + WATER_HEATER_OFF_MARGIN_TENTHS < setTenths))
         {
             Element_SetElementOn(WATER_HEATER_HEATING_ELEMENT);
             Element_SetElementOff(WATER_HEATER_COOLING_ELEMENT);
@@ -376,12 +597,17 @@ static Std_ReturnType WaterHeater_TakeAction(void)
         {
             /* An Added Feature To Control The Water's Temprature By Turning Off The Heater And The Cooler When The
              * Temprature Difference Is Less Than 5 Degrees */
-#ifdef ADD_WATER_TEMPRATURE_CONTROL_FEATURE
-            Element_SetElementOff(WATER_HEATER_HEATING_ELEMENT);
-            Element_SetElementOff(WATER_HEATER_COOLING_ELEMENT);
-            Led_SetLedOff(WATER_HEATER_HEATING_LED);
-            WaterHeater_runningElement = WATER_HEATER_NO_ELEMENT_RUNNING;
-#endif
+            if(WATER_HEATER_CONTROL_FEATURE)
+            {
+                Element_SetElementOff(WATER_HEATER_HEATING_ELEMENT);
+                Element_SetElementOff(WATER_HEATER_COOLING_ELEMENT);
+                Led_SetLedOff(WATER_HEATER_HEATING_LED);
+                WaterHeater_runningElement = WATER_HEATER_NO_ELEMENT_RUNNING;
+            }
+            else
+            {
+                /* Empty Else Statement To Satisfy The Misra Rules */
+            }
         }
     }
     else
@@ -400,8 +626,8 @@ static Std_ReturnType WaterHeater_TakeAction(void)
  */
 static Std_ReturnType WaterHeater_Blink(void)
 {
-    static Led_State_t heatingLedState = LED_OFF;
-    static SSeg_display_t ssegDisp = SSEG_OFF;
+    static HW_INSTANCE Led_State_t heatingLedState = LED_OFF;
+    static HW_INSTANCE SSeg_display_t ssegDisp = SSEG_OFF;
     /* If The Led Should Be Toggled */
     if(WaterHeater_mode != WATER_HEATER_OFF_MODE && WaterHeater_runningElement == WATER_HEATER_HEATING_ELEMENT_RUNNING)
     {
@@ -423,4 +649,40 @@ static Std_ReturnType WaterHeater_Blink(void)
         /* Empty Else Statement To Satisfy The Misra Rules */
     }
     return E_OK;
-}
\ No newline at end of file
+}
+#ifdef HW_HOST
+/**
+ * @brief Gets the configured tuning of the application
+ * 
+ * @param tuning The tuning
+ */
+void WaterHeater_GetDefaultTuning(waterHeaterTuning_t* tuning)
+{
+    tuning->changeRate = WATER_HEATER_DEFAULT_CHANGE_RATE;
+    tuning->numberOfReadings = WATER_HEATER_DEFAULT_NUMBER_OF_READINGS;
+    tuning->controlFeature = WATER_HEATER_DEFAULT_CONTROL_FEATURE;
+}
+
+/**
+ * @brief Sets the tuning of this instance of the application, it must be called before the scheduler starts
+ * 
+ * @param tuning The tuning
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType WaterHeater_SetTuning(const waterHeaterTuning_t* tuning)
+{
+    Std_ReturnType error = E_NOT_OK;
+    if(tuning->changeRate > 0 && tuning->numberOfReadings > 0 && tuning->numberOfReadings <= WATER_HEATER_MAX_NUMBER_OF_READINGS)
+    {
+        WaterHeater_tuning = *tuning;
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else Statement To Satisfy The Misra Rules */
+    }
+    return error;
+}
+#endif
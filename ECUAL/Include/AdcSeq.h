@@ -0,0 +1,74 @@
+/**
+ * @file AdcSeq.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the user interface for the ADC Scan Sequencer, it converts the configured channels
+ *        one after the other in the background and keeps the last samples of every sensor
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef ADC_SEQUENCER_H
+#define ADC_SEQUENCER_H
+#include "AdcSeq_Cfg.h"
+
+typedef uint8_t AdcSeq_Sensor_t;
+
+typedef struct
+{
+    Adc_Channel_t channel;
+    /* The Window Of The Trimmed Mean Or Median Filter, 0 Without A Filter */
+    uint8_t filterWindow;
+    /* The Samples Trimmed From Each End Of The Window, Or FILTER_MEDIAN */
+    uint8_t filterTrim;
+} adcSeqSensor_t;
+
+/* The Resolution Of The Samples, The 10-Bit Conversions And The Oversampling Bits */
+#define ADCSEQ_RESOLUTION_BITS              (10 + ADCSEQ_OVERSAMPLING_BITS)
+
+/**
+ * @brief Initializes the ADC, the pins of all the channels, the filters and the mux for the first sensor
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if a filter is not valid, its sensor is left without a filter
+ */
+extern Std_ReturnType AdcSeq_Init(void);
+
+/**
+ * @brief Gets the last sample of a sensor without waiting
+ *
+ * @param sensor The sensor
+ * @param value The sample
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured or it has no sample yet
+ */
+extern Std_ReturnType AdcSeq_GetLatest(AdcSeq_Sensor_t sensor, Adc_Value_t* value);
+
+/**
+ * @brief Gets the last samples of a sensor without waiting, the oldest one first
+ *
+ * @param sensor The sensor
+ * @param values The samples
+ * @param count The number of samples, up to ADCSEQ_BUFFER_SIZE - 1
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured, the count is too big or there are fewer samples yet
+ */
+extern Std_ReturnType AdcSeq_GetSamples(AdcSeq_Sensor_t sensor, Adc_Value_t* values, uint8_t count);
+
+/**
+ * @brief Gets the output of the filter of a sensor without waiting, the last sample for a sensor without a filter
+ *        The filter takes the samples in the task of the sequencer, up to one period after they are converted
+ *
+ * @param sensor The sensor
+ * @param value The filtered sample
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured or it has no sample yet
+ */
+extern Std_ReturnType AdcSeq_GetFiltered(AdcSeq_Sensor_t sensor, Adc_Value_t* value);
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ * @file AdcSeq_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief These are the user's configurations for the ADC Scan Sequencer
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef ADC_SEQUENCER_CONFIG_H
+#define ADC_SEQUENCER_CONFIG_H
+
+/* One Burst Of Conversions Starts Every Period, The Mux Moves To The Next Sensor When It Completes
+ * So Every Sensor Gives One Sample Every ADCSEQ_NUMBER_OF_SENSORS Periods */
+#define ADCSEQ_TASK_PERIOD_MS               25
+
+/* A Burst Is 4^n Back To Back Conversions Of The Same Sensor, Their Sum Shifted Right By n Is A
+ * Sample With n More Bits, The Noise Of The Input Dithers The Extra Bits (0 To 3) */
+#define ADCSEQ_OVERSAMPLING_BITS            2
+
+/* The Time The Input Needs To Settle After The Mux Moved, It Must Fit In A Period */
+#define ADCSEQ_ACQUISITION_TIME_US          20
+
+/* The Samples Kept Per Sensor, A Power Of Two, The Last ADCSEQ_BUFFER_SIZE - 1 Samples Can Be Read */
+#define ADCSEQ_BUFFER_SIZE                  8
+
+/* The Longest Window Of The Trimmed Mean Or Median Filter Of A Sensor, AdcSeq_Cfg.c Sets The Filter Per Sensor */
+#define ADCSEQ_MAX_FILTER_WINDOW            5
+
+#define ADCSEQ_NUMBER_OF_SENSORS            4
+
+#define WATER_HEATER_TANK_TOP_SENSOR        0
+#define WATER_HEATER_TANK_BOTTOM_SENSOR     1
+#define WATER_HEATER_INLET_SENSOR           2
+#define WATER_HEATER_AMBIENT_SENSOR         3
+
+#endif
@@ -0,0 +1,64 @@
+/**
+ * @file Cal.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the user interface for the sensor calibration, a sample is linearized by a table that is
+ *        generated on the host for the sensor curve, then the trims of the unit correct its offset and gain,
+ *        all in integer math
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef CAL_H
+#define CAL_H
+#include "Cal_Cfg.h"
+
+/* A Temperature In Tenths Of A Degree */
+typedef sint16_t calTemperature_t;
+
+typedef struct
+{
+    /* The Linearization Table Of The Sensor Curve, CAL_TABLE_POINTS Points */
+    const calTemperature_t* table;
+} calSensor_t;
+
+/* The Gain Trim Is In Steps Of 1 / 2^CAL_GAIN_TRIM_BITS */
+#define CAL_GAIN_TRIM_BITS                  10
+
+/**
+ * @brief Reads the trims of all the sensors from the EEPROM, a sensor without valid trims is not trimmed
+ *        The EEPROM must be initialized first
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the EEPROM could not be read
+ */
+extern Std_ReturnType Cal_Init(void);
+
+/**
+ * @brief Converts a sample of a sensor to a temperature
+ *
+ * @param sensor The sensor
+ * @param counts The sample, ADCSEQ_RESOLUTION_BITS bits
+ * @param temperature The temperature in tenths of a degree
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured
+ */
+extern Std_ReturnType Cal_Convert(AdcSeq_Sensor_t sensor, Adc_Value_t counts, calTemperature_t* temperature);
+
+/**
+ * @brief Sets the trims of a sensor and writes them to the EEPROM, the temperature becomes
+ *        T + T * gain / 2^CAL_GAIN_TRIM_BITS + offset
+ *
+ * @param sensor The sensor
+ * @param offset The offset in tenths of a degree
+ * @param gain The gain in steps of 1 / 2^CAL_GAIN_TRIM_BITS
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured or the EEPROM could not be written
+ */
+extern Std_ReturnType Cal_SetTrim(AdcSeq_Sensor_t sensor, sint8_t offset, sint8_t gain);
+
+#endif
@@ -0,0 +1,20 @@
+/**
+ * @file Cal_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief These are the user's configurations for the sensor calibration
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef CAL_CONFIG_H
+#define CAL_CONFIG_H
+
+/* One Calibration Per Sensor Of The Sequencer, Cal_Cfg.c Gives The Table Of Each Sensor */
+#define CAL_NUMBER_OF_SENSORS               ADCSEQ_NUMBER_OF_SENSORS
+
+/* The Trims Of The Unit In The EEPROM, Three Bytes Per Sensor */
+#define CAL_TRIM_ADDRESS                    (Eeprom_Address_t)0x0020
+
+#endif
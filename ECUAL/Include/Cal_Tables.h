@@ -0,0 +1,24 @@
+/**
+ * @file Cal_Tables.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The sensor linearization tables, generated by water_heater_cal from SIM/Include/CalGen_Cfg.h
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef CAL_TABLES_H_
+#define CAL_TABLES_H_
+
+/* The Bits Of The Samples And Of The Segments Between Two Points */
+#define CAL_TABLE_INPUT_BITS                12
+#define CAL_TABLE_SEGMENT_BITS              6
+#define CAL_TABLE_POINTS                    65
+
+extern const calTemperature_t Cal_lm35Table[CAL_TABLE_POINTS];
+extern const calTemperature_t Cal_ntcBetaTable[CAL_TABLE_POINTS];
+extern const calTemperature_t Cal_ntcSteinhartHartTable[CAL_TABLE_POINTS];
+extern const calTemperature_t Cal_pt1000Table[CAL_TABLE_POINTS];
+
+#endif
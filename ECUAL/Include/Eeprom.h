@@ -1,7 +1,7 @@
 /**
  * @file Eeprom.h
  * @author Mark Attia (markjosephattia@gmail.com)
- * @brief This is the user interface for the EEPROM driver 
+ * @brief This is the user interface for the EEPROM driver, I2c.h has to be included before it
  * @version 0.1
  * @date 2020-07-05
  * 
@@ -10,9 +10,18 @@
  */
 #ifndef EEPROM_H_
 #define EEPROM_H_
+#include "Eeprom_Cfg.h"
 
 typedef uint16_t Eeprom_Address_t;
 
+/* A Write That Completes In The Interrupt, It Has To Stay Valid Until Then */
+typedef struct
+{
+    i2cTransaction_t transaction;
+    /* The Two Bytes Of The Address And The Data */
+    uint8_t buffer[2 + EEPROM_REQUEST_SIZE];
+} eepromRequest_t;
+
 /**
  * @brief Initializes the EEPROM
  * 
@@ -29,7 +38,7 @@ extern Std_ReturnType Eeprom_Init(void);
  * @param data The data to write
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_NOT_OK : if the EEPROM did not acknowledge within EEPROM_ACK_POLLS tries or the bus timed out
  */
 extern Std_ReturnType Eeprom_WriteByte(Eeprom_Address_t address, uint8_t data);
 
@@ -40,8 +49,52 @@ extern Std_ReturnType Eeprom_WriteByte(Eeprom_Address_t address, uint8_t data);
  * @param data The data to read
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_NOT_OK : if the EEPROM did not acknowledge within EEPROM_ACK_POLLS tries or the bus timed out
  */
 extern Std_ReturnType Eeprom_ReadByte(Eeprom_Address_t address, uint8_t* data);
 
+/**
+ * @brief Writes bytes to the EEPROM with one page write per page they fall in, so a block inside
+ *        a page of EEPROM_PAGE_SIZE bytes takes one write cycle instead of one per byte
+ * 
+ * @param address The address of the first byte
+ * @param data The data to write
+ * @param length The number of bytes, the addresses must not pass the end of the EEPROM
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the length is 0, or a page was not written, the pages after it are not written
+ */
+extern Std_ReturnType Eeprom_WritePage(Eeprom_Address_t address, const uint8_t* data, uint8_t length);
+
+/**
+ * @brief Reads bytes from the EEPROM with one sequential read, every byte is acknowledged but the last
+ * 
+ * @param address The address of the first byte
+ * @param data The data to read
+ * @param length The number of bytes
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the length is 0, or the EEPROM did not acknowledge within EEPROM_ACK_POLLS tries or the bus timed out
+ */
+extern Std_ReturnType Eeprom_ReadBlock(Eeprom_Address_t address, uint8_t* data, uint8_t length);
+
+/**
+ * @brief Writes bytes inside a page to the EEPROM without waiting, the data is copied to the request and
+ *        the call back gets the transaction when it completes
+ *        A write that is not acknowledged is not queued again, polling from the interrupt would keep the bus
+ *        busy for the whole write cycle, a status of I2C_STATUS_NACK means the EEPROM was busy or missing and
+ *        nothing was written, the caller tries again later, I2C_STATUS_TIMEOUT means the bus hung and was recovered,
+ *        I2C_STATUS_BUS_LOCKED that a slave still held SDA low after the recovery
+ * 
+ * @param request The request, it must not be pending
+ * @param address The address of the first byte
+ * @param data The data to write
+ * @param length The number of bytes (1 .. EEPROM_REQUEST_SIZE), they must not pass the end of their page
+ * @param callBack The call back, called from the interrupt, or NULL
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the write is queued
+ *                  E_NOT_OK : if the length is not valid, the request is pending or the write could not be queued
+ */
+extern Std_ReturnType Eeprom_WriteAsync(eepromRequest_t* request, Eeprom_Address_t address, const uint8_t* data, uint8_t length, i2cCallBack_t callBack);
+
 #endif
\ No newline at end of file
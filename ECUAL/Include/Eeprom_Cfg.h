@@ -0,0 +1,25 @@
+/**
+ * @file Eeprom_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief These are the user's configurations for the EEPROM driver
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef EEPROM_CONFIG_H
+#define EEPROM_CONFIG_H
+
+/* The Tries Of A Waiting Transaction While The EEPROM Does Not Acknowledge, A Try Takes About 150 us At 100 kHz
+ * And The Write Cycle Is Up To 5 ms, A Missing EEPROM Fails After About 15 ms, Eeprom_WriteAsync Tries Once */
+#define EEPROM_ACK_POLLS                    100
+
+/* The Bytes Of A Page Write, A Power Of 2 Up To The Page Of The Device (64 Bytes On A 24C256),
+ * A Smaller Page Is Still Aligned To The Device Pages And Takes Less RAM For The Buffer */
+#define EEPROM_PAGE_SIZE                    16
+
+/* The Most Bytes Of A Write Without Waiting, Every Request Keeps A Copy */
+#define EEPROM_REQUEST_SIZE                 4
+
+#endif
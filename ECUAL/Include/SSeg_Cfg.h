@@ -17,4 +17,7 @@
 #define SSEG_TENS                      0     
 #define SSEG_ONES                      1
 
+/* The Displays Are Multiplexed, One Digit Per Period */
+#define SSEG_TASK_PERIOD_MS            25
+
 #endif
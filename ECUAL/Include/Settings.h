@@ -0,0 +1,74 @@
+/**
+ * @file Settings.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the user interface for the settings store, every commit appends a record with all the
+ *        settings, a sequence number and a CRC to a log that goes round the slots of a region of the EEPROM,
+ *        an A/B pair by default, and the newest intact record is found by a binary search at boot
+ *        Eeprom.h has to be included before it
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef SETTINGS_H
+#define SETTINGS_H
+#include "Settings_Cfg.h"
+
+typedef uint8_t settingsKey_t;
+typedef uint8_t settingsValue_t;
+
+/**
+ * @brief Loads the settings from the newest valid record of the log, the settings without a record
+ *        take their values of Settings_Cfg.c, the EEPROM must be initialized first
+ *        The log is read up to SETTINGS_SCAN_TRIES times
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the EEPROM could not be read, the settings take their values of Settings_Cfg.c
+ *                            and the commits read the log again before they write
+ */
+extern Std_ReturnType Settings_Init(void);
+
+/**
+ * @brief Gets the value of a setting
+ *
+ * @param key The setting
+ * @param value The value
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the setting is not configured
+ */
+extern Std_ReturnType Settings_Get(settingsKey_t key, settingsValue_t* value);
+
+/**
+ * @brief Sets the value of a setting, it is saved by the next commit
+ *
+ * @param key The setting
+ * @param value The value
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the setting is not configured
+ */
+extern Std_ReturnType Settings_Set(settingsKey_t key, settingsValue_t value);
+
+/**
+ * @brief Queues the write of a record with the settings if one changed since the last record, it completes
+ *        in the I2C interrupt and the settings stay changed until it succeeds
+ *        If the log could not be read by Settings_Init it is read here first, waiting for the bus
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the record is queued or nothing changed
+ *                 E_NOT_OK : if the last record is still being written, the log could not be read or the record could not be queued
+ */
+extern Std_ReturnType Settings_Commit(void);
+
+/**
+ * @brief Tells if a setting is not in an intact record yet, because it changed since the last commit,
+ *        its record is still being written or the write failed, the caller commits again until it is not
+ *
+ * @return uint8_t 1 if the settings are not saved, 0 if they are
+ */
+extern uint8_t Settings_IsDirty(void);
+
+#endif
@@ -0,0 +1,36 @@
+/**
+ * @file Settings_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief These are the user's configurations for the settings store
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef SETTINGS_CONFIG_H
+#define SETTINGS_CONFIG_H
+
+/* The Settings, Settings_Cfg.c Gives The Value Of Each One Before It Is First Saved */
+#define SETTINGS_NUMBER_OF_SETTINGS         1
+
+#define WATER_HEATER_SETPOINT_SETTING       0
+
+/* The Region Of The Log In The EEPROM, It Starts On A Page, A Record Is Written In The First Bytes Of A Slot
+ * The Default Is An A/B Pair, Every Commit Writes The Slot Of The Older Record In Its Own Page Of The Device
+ * (64 Bytes On A 24C256) And A Lookup Reads Both. More Slots Spread The Wear Over More Pages, The Endurance
+ * Of The Settings Is The One Of A Page Times The Pages Of The Region And A Lookup Reads 1 + log2(Slots) Records,
+ * 256 Slots Of 4 Bytes Take 1 KB And 9 Reads */
+#define SETTINGS_REGION_ADDRESS             (Eeprom_Address_t)0x0100
+#define SETTINGS_NUMBER_OF_SLOTS            2
+/* A Power Of 2 */
+#define SETTINGS_SLOT_SIZE                  64
+
+/* The Bytes Of A Record, The Sequence Number, The Values And The CRC, A Power Of 2 */
+#define SETTINGS_RECORD_SIZE                4
+
+/* The Reads Of The Log At Boot Before The Settings Take Their Initial Values, A Read Fails After About 15 ms
+ * Without The EEPROM, The Commits Do Not Write Until The Log Is Read */
+#define SETTINGS_SCAN_TRIES                 3
+
+#endif
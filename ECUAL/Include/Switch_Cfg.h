@@ -11,6 +11,12 @@
 
 #define SWITCH_USE_RTOS
 
+/* The Switches Are Sampled Every Period And Settle After The Debounce Samples Read The Same State (25 ms),
+ * A Period Longer Than The Scheduler Tick Lets The Tickless Scheduler Skip Ticks But Changes The Debounce
+ * And The Latency Of The Buttons, The Period Times The Samples Should Stay About The Same */
+#define SWITCH_TASK_PERIOD_MS               5
+#define SWITCH_DEBOUNCE_SAMPLES             5
+
 #define SWITCH_NUMBER_OF_SWITCHES           3
 
 #define WATER_HEATER_ON_OFF_BUTTON                            0
@@ -0,0 +1,265 @@
+/**
+ * @file AdcSeq.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the implementation for the ADC Scan Sequencer, the task starts one burst per period,
+ *        the conversion complete interrupt restarts the conversion until the burst is complete,
+ *        then it keeps the decimated sample and moves the mux to the next sensor,
+ *        the interrupt is the only writer of the ring buffers so the readers never lock,
+ *        the task feeds the new samples to the filters of the sensors
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "Int.h"
+#include "Adc.h"
+#include "Filter.h"
+#include "AdcSeq.h"
+#include "Sched.h"
+#include "Hw.h"
+
+/* The Index Mask Of The Ring Buffers */
+#define ADCSEQ_BUFFER_MASK                  (ADCSEQ_BUFFER_SIZE - 1)
+/* The Conversions Of A Burst, 4^n */
+#define ADCSEQ_OVERSAMPLES                  (1U << (2 * ADCSEQ_OVERSAMPLING_BITS))
+
+/* The Ring Buffers Wrap With A Mask And Their Indices Are 8-Bit, The Mux Settles Before The Next Start */
+STD_STATIC_ASSERT(ADCSEQ_BUFFER_SIZE >= 2 && ADCSEQ_BUFFER_SIZE <= 128 && (ADCSEQ_BUFFER_SIZE & ADCSEQ_BUFFER_MASK) == 0, AdcSeq_bufferSizeCheck);
+STD_STATIC_ASSERT(ADCSEQ_TASK_PERIOD_MS * 1000UL > ADCSEQ_ACQUISITION_TIME_US, AdcSeq_acquisitionCheck);
+/* The Sum Of A Burst Of 10-Bit Conversions Fits The 16-Bit Accumulator */
+STD_STATIC_ASSERT(ADCSEQ_OVERSAMPLING_BITS <= 3, AdcSeq_oversamplingCheck);
+/* The Filters Are Kept In A Mask Of One Bit Per Sensor */
+STD_STATIC_ASSERT(ADCSEQ_NUMBER_OF_SENSORS <= 8, AdcSeq_sensorsCheck);
+STD_STATIC_ASSERT(ADCSEQ_MAX_FILTER_WINDOW >= 1 && ADCSEQ_MAX_FILTER_WINDOW <= FILTER_MAX_WINDOW, AdcSeq_filterWindowCheck);
+
+typedef struct
+{
+    volatile Adc_Value_t samples[ADCSEQ_BUFFER_SIZE];
+    /* The Slot Of The Next Sample, It Moves After The Sample Is Written */
+    volatile uint8_t head;
+    /* The Samples Written So Far, Up To ADCSEQ_BUFFER_SIZE */
+    volatile uint8_t count;
+} adcSeqBuffer_t;
+
+extern const adcSeqSensor_t AdcSeq_sensors[ADCSEQ_NUMBER_OF_SENSORS];
+static HW_INSTANCE adcSeqBuffer_t AdcSeq_buffer[ADCSEQ_NUMBER_OF_SENSORS];
+/* The Filters Of The Sensors, Only Used By The Task And Its Readers */
+static HW_INSTANCE filter_t AdcSeq_filter[ADCSEQ_NUMBER_OF_SENSORS];
+static HW_INSTANCE filterSample_t AdcSeq_window[ADCSEQ_NUMBER_OF_SENSORS][ADCSEQ_MAX_FILTER_WINDOW];
+static HW_INSTANCE filterSample_t AdcSeq_sorted[ADCSEQ_NUMBER_OF_SENSORS][ADCSEQ_MAX_FILTER_WINDOW];
+/* The Slot After The Last Sample Each Filter Took */
+static HW_INSTANCE uint8_t AdcSeq_filtered[ADCSEQ_NUMBER_OF_SENSORS];
+/* The Sensors With A Filter, One Bit Per Sensor */
+static HW_INSTANCE uint8_t AdcSeq_filterMask;
+/* The Sensor The Mux Is On */
+static HW_INSTANCE volatile AdcSeq_Sensor_t AdcSeq_current;
+/* The Sum And The Number Of The Conversions Of The Running Burst */
+static HW_INSTANCE volatile uint16_t AdcSeq_sum;
+static HW_INSTANCE volatile uint8_t AdcSeq_conversions;
+
+/**
+ * @brief Adds a conversion to the burst, a complete burst is decimated into a sample of the current sensor
+ *        and the mux moves to the next one, it runs in the ADC interrupt so the input settles until the next start
+ *
+ */
+static void AdcSeq_ConversionDone(void)
+{
+    adcSeqBuffer_t* buffer = &AdcSeq_buffer[AdcSeq_current];
+    Adc_Value_t value;
+    if(Adc_GetResult(&value) == E_OK)
+    {
+        AdcSeq_sum += value;
+        AdcSeq_conversions++;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(AdcSeq_conversions < ADCSEQ_OVERSAMPLES)
+    {
+        /* The Mux Stays On The Sensor, The Next Conversion Needs No Acquisition Time */
+        Adc_StartConversion();
+    }
+    else
+    {
+        buffer->samples[buffer->head] = AdcSeq_sum >> ADCSEQ_OVERSAMPLING_BITS;
+        buffer->head = (buffer->head + 1) & ADCSEQ_BUFFER_MASK;
+        if(buffer->count < ADCSEQ_BUFFER_SIZE)
+        {
+            buffer->count++;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        AdcSeq_sum = 0;
+        AdcSeq_conversions = 0;
+        AdcSeq_current = (AdcSeq_current + 1 == ADCSEQ_NUMBER_OF_SENSORS) ? 0 : AdcSeq_current + 1;
+        Adc_SwitchChannel(AdcSeq_sensors[AdcSeq_current].channel);
+    }
+}
+
+/**
+ * @brief Initializes the ADC, the pins of all the channels, the filters and the mux for the first sensor
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if a filter is not valid, its sensor is left without a filter
+ */
+Std_ReturnType AdcSeq_Init(void)
+{
+    Std_ReturnType error = E_OK;
+    uint8_t i;
+    Adc_Init();
+    AdcSeq_filterMask = 0;
+    /* The Pins Are Initialized Once, The Sequence Only Moves The Mux */
+    for(i=0; i<ADCSEQ_NUMBER_OF_SENSORS; i++)
+    {
+        Adc_InitChannel(AdcSeq_sensors[i].channel);
+        AdcSeq_buffer[i].head = 0;
+        AdcSeq_buffer[i].count = 0;
+        AdcSeq_filtered[i] = 0;
+        if(0 == AdcSeq_sensors[i].filterWindow)
+        {
+            /* The Sensor Has No Filter */
+        }
+        else if(AdcSeq_sensors[i].filterWindow <= ADCSEQ_MAX_FILTER_WINDOW &&
+                Filter_InitTrimmed(&AdcSeq_filter[i], AdcSeq_window[i], AdcSeq_sorted[i], AdcSeq_sensors[i].filterWindow, AdcSeq_sensors[i].filterTrim) == E_OK)
+        {
+            AdcSeq_filterMask |= (uint8_t)(1U << i);
+        }
+        else
+        {
+            error = E_NOT_OK;
+        }
+    }
+    AdcSeq_current = 0;
+    AdcSeq_sum = 0;
+    AdcSeq_conversions = 0;
+    Adc_SwitchChannel(AdcSeq_sensors[0].channel);
+    Adc_SetCallBack(AdcSeq_ConversionDone);
+    return error;
+}
+
+/**
+ * @brief Gets the last sample of a sensor without waiting
+ *
+ * @param sensor The sensor
+ * @param value The sample
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured or it has no sample yet
+ */
+Std_ReturnType AdcSeq_GetLatest(AdcSeq_Sensor_t sensor, Adc_Value_t* value)
+{
+    Std_ReturnType error = E_NOT_OK;
+    if(sensor < ADCSEQ_NUMBER_OF_SENSORS && AdcSeq_buffer[sensor].count)
+    {
+        *value = AdcSeq_buffer[sensor].samples[(AdcSeq_buffer[sensor].head - 1) & ADCSEQ_BUFFER_MASK];
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Gets the last samples of a sensor without waiting, the oldest one first
+ *        One slot is left out so the interrupt never writes a slot that is being read
+ *
+ * @param sensor The sensor
+ * @param values The samples
+ * @param count The number of samples, up to ADCSEQ_BUFFER_SIZE - 1
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured, the count is too big or there are fewer samples yet
+ */
+Std_ReturnType AdcSeq_GetSamples(AdcSeq_Sensor_t sensor, Adc_Value_t* values, uint8_t count)
+{
+    Std_ReturnType error = E_NOT_OK;
+    uint8_t head;
+    uint8_t i;
+    if(sensor < ADCSEQ_NUMBER_OF_SENSORS && count < ADCSEQ_BUFFER_SIZE && count <= AdcSeq_buffer[sensor].count)
+    {
+        /* The Samples Before The Head Stay Valid While They Are Copied */
+        head = AdcSeq_buffer[sensor].head;
+        for(i=0; i<count; i++)
+        {
+            values[i] = AdcSeq_buffer[sensor].samples[(uint8_t)(head - count + i) & ADCSEQ_BUFFER_MASK];
+        }
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Gets the output of the filter of a sensor without waiting, the last sample for a sensor without a filter
+ *        The filter takes the samples in the task of the sequencer, up to one period after they are converted
+ *
+ * @param sensor The sensor
+ * @param value The filtered sample
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured or it has no sample yet
+ */
+Std_ReturnType AdcSeq_GetFiltered(AdcSeq_Sensor_t sensor, Adc_Value_t* value)
+{
+    Std_ReturnType error = E_NOT_OK;
+    if(sensor < ADCSEQ_NUMBER_OF_SENSORS && (AdcSeq_filterMask & (uint8_t)(1U << sensor)))
+    {
+        /* The Samples Are Kept In Counts */
+        error = Filter_GetValue(&AdcSeq_filter[sensor], 1, 1, value);
+    }
+    else
+    {
+        error = AdcSeq_GetLatest(sensor, value);
+    }
+    return error;
+}
+
+/**
+ * @brief Feeds the samples converted since the last run to the filters of the sensors,
+ *        the interrupt writes at the head so the slots before it stay valid while they are read
+ *
+ */
+static void AdcSeq_FilterSamples(void)
+{
+    uint8_t head;
+    uint8_t i;
+    for(i=0; i<ADCSEQ_NUMBER_OF_SENSORS; i++)
+    {
+        if(AdcSeq_filterMask & (uint8_t)(1U << i))
+        {
+            head = AdcSeq_buffer[i].head;
+            while(AdcSeq_filtered[i] != head)
+            {
+                Filter_Add(&AdcSeq_filter[i], AdcSeq_buffer[i].samples[AdcSeq_filtered[i]]);
+                AdcSeq_filtered[i] = (AdcSeq_filtered[i] + 1) & ADCSEQ_BUFFER_MASK;
+            }
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+}
+
+/**
+ * @brief The running task of the sequencer, it filters the new samples and starts the burst of the sensor the mux moved to
+ *
+ */
+static void AdcSeq_Runnable(void)
+{
+    AdcSeq_FilterSamples();
+    Adc_StartConversion();
+}
+
+const task_t AdcSeq_task = {AdcSeq_Runnable, ADCSEQ_TASK_PERIOD_MS};
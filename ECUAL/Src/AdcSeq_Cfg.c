@@ -0,0 +1,24 @@
+/**
+ * @file  AdcSeq_Cfg.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief These are the configurations for the ADC Scan Sequencer
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "Int.h"
+#include "Adc.h"
+#include "Filter.h"
+#include "AdcSeq.h"
+
+/* The Channels In The Order Of The Sensors, RA4 And RA5 Drive The Display,
+ * The Median Of 5 On The Tank Top Rejects Up To Two Spikes In A Row From The Element Switching */
+const adcSeqSensor_t AdcSeq_sensors[ADCSEQ_NUMBER_OF_SENSORS] = {
+    {ADC_CH_2, 5, FILTER_MEDIAN},
+    {ADC_CH_0, 0, 0},
+    {ADC_CH_1, 0, 0},
+    {ADC_CH_3, 0, 0}
+};
@@ -0,0 +1,165 @@
+/**
+ * @file Cal.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the implementation for the sensor calibration, the tables have a point every
+ *        2^CAL_TABLE_SEGMENT_BITS counts so the segment of a sample is found by a shift and the
+ *        interpolation only multiplies, the trims are kept in the EEPROM with a check byte
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "Int.h"
+#include "Adc.h"
+#include "AdcSeq.h"
+#include "I2c.h"
+#include "Eeprom.h"
+#include "Cal.h"
+#include "Cal_Tables.h"
+#include "Hw.h"
+
+/* The Trims Of A Sensor In The EEPROM, The Offset, The Gain And The Check Byte */
+#define CAL_TRIM_SIZE                       3
+#define CAL_TRIM_OFFSET                     0
+#define CAL_TRIM_GAIN                       1
+#define CAL_TRIM_CHECK                      2
+/* The Check Byte Is The Two Trims XORed With This, An Erased EEPROM Fails It */
+#define CAL_TRIM_CHECK_KEY                  0x5A
+
+#define CAL_SEGMENT_MASK                    ((1U << CAL_TABLE_SEGMENT_BITS) - 1)
+
+/* The Tables Are Generated For The Resolution Of The Samples, make cal Generates Them Again */
+STD_STATIC_ASSERT(CAL_TABLE_INPUT_BITS == ADCSEQ_RESOLUTION_BITS, Cal_tableResolutionCheck);
+/* The Segment Of A Sample Is An 8-Bit Index */
+STD_STATIC_ASSERT(CAL_TABLE_POINTS <= 256, Cal_tablePointsCheck);
+
+typedef struct
+{
+    sint8_t offset;
+    sint8_t gain;
+} calTrim_t;
+
+extern const calSensor_t Cal_sensors[CAL_NUMBER_OF_SENSORS];
+static HW_INSTANCE calTrim_t Cal_trim[CAL_NUMBER_OF_SENSORS];
+
+/**
+ * @brief Divides by 2^bits and rounds to the nearest, the halves away from zero
+ *
+ * @param value The value
+ * @param bits The bits
+ * @return sint32_t The rounded quotient
+ */
+static sint32_t Cal_RoundShift(sint32_t value, uint8_t bits)
+{
+    sint32_t half = (sint32_t)1 << (bits - 1);
+    return ((value >= 0) ? value + half : value - half) / ((sint32_t)1 << bits);
+}
+
+/**
+ * @brief Reads the trims of all the sensors from the EEPROM, a sensor without valid trims is not trimmed
+ *        The EEPROM must be initialized first
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the EEPROM could not be read
+ */
+Std_ReturnType Cal_Init(void)
+{
+    Std_ReturnType error = E_OK;
+    uint8_t trim[CAL_TRIM_SIZE];
+    uint8_t sensor;
+    for(sensor=0; sensor<CAL_NUMBER_OF_SENSORS; sensor++)
+    {
+        Cal_trim[sensor].offset = 0;
+        Cal_trim[sensor].gain = 0;
+        if(Eeprom_ReadBlock(CAL_TRIM_ADDRESS + sensor * CAL_TRIM_SIZE, trim, CAL_TRIM_SIZE) != E_OK)
+        {
+            error = E_NOT_OK;
+        }
+        else if((trim[CAL_TRIM_OFFSET] ^ trim[CAL_TRIM_GAIN] ^ CAL_TRIM_CHECK_KEY) == trim[CAL_TRIM_CHECK])
+        {
+            Cal_trim[sensor].offset = (sint8_t)trim[CAL_TRIM_OFFSET];
+            Cal_trim[sensor].gain = (sint8_t)trim[CAL_TRIM_GAIN];
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return error;
+}
+
+/**
+ * @brief Converts a sample of a sensor to a temperature
+ *
+ * @param sensor The sensor
+ * @param counts The sample, ADCSEQ_RESOLUTION_BITS bits
+ * @param temperature The temperature in tenths of a degree
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured
+ */
+Std_ReturnType Cal_Convert(AdcSeq_Sensor_t sensor, Adc_Value_t counts, calTemperature_t* temperature)
+{
+    Std_ReturnType error = E_NOT_OK;
+    const calTemperature_t* table;
+    uint8_t index;
+    sint32_t value;
+    if(sensor < CAL_NUMBER_OF_SENSORS)
+    {
+        table = Cal_sensors[sensor].table;
+        index = (uint8_t)(counts >> CAL_TABLE_SEGMENT_BITS);
+        if(index < CAL_TABLE_POINTS - 1)
+        {
+            /* The Straight Line Between The Two Points Around The Sample */
+            value = table[index] + Cal_RoundShift((sint32_t)(table[index + 1] - table[index]) * (counts & CAL_SEGMENT_MASK), CAL_TABLE_SEGMENT_BITS);
+        }
+        else
+        {
+            value = table[CAL_TABLE_POINTS - 1];
+        }
+        /* The Gain Is Trimmed Around 0 C, Then The Offset */
+        value += Cal_RoundShift(value * Cal_trim[sensor].gain, CAL_GAIN_TRIM_BITS) + Cal_trim[sensor].offset;
+        *temperature = (calTemperature_t)value;
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Sets the trims of a sensor and writes them to the EEPROM, the temperature becomes
+ *        T + T * gain / 2^CAL_GAIN_TRIM_BITS + offset
+ *
+ * @param sensor The sensor
+ * @param offset The offset in tenths of a degree
+ * @param gain The gain in steps of 1 / 2^CAL_GAIN_TRIM_BITS
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the sensor is not configured or the EEPROM could not be written
+ */
+Std_ReturnType Cal_SetTrim(AdcSeq_Sensor_t sensor, sint8_t offset, sint8_t gain)
+{
+    Std_ReturnType error = E_NOT_OK;
+    uint8_t trim[CAL_TRIM_SIZE];
+    if(sensor < CAL_NUMBER_OF_SENSORS)
+    {
+        Cal_trim[sensor].offset = offset;
+        Cal_trim[sensor].gain = gain;
+        trim[CAL_TRIM_OFFSET] = (uint8_t)offset;
+        trim[CAL_TRIM_GAIN] = (uint8_t)gain;
+        trim[CAL_TRIM_CHECK] = (uint8_t)offset ^ (uint8_t)gain ^ CAL_TRIM_CHECK_KEY;
+        /* One Write Cycle, The Check Byte Is Last So A Write Split Across Two Pages And Cut Short Reads Back As No Trims */
+        error = Eeprom_WritePage(CAL_TRIM_ADDRESS + sensor * CAL_TRIM_SIZE, trim, CAL_TRIM_SIZE);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
@@ -0,0 +1,26 @@
+/**
+ * @file  Cal_Cfg.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief These are the configurations for the sensor calibration
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "Int.h"
+#include "Adc.h"
+#include "AdcSeq.h"
+#include "I2c.h"
+#include "Eeprom.h"
+#include "Cal.h"
+#include "Cal_Tables.h"
+
+/* The Tables In The Order Of The Sensors, The Fitted Sensor Type Only Changes This Table */
+const calSensor_t Cal_sensors[CAL_NUMBER_OF_SENSORS] = {
+    {Cal_lm35Table},
+    {Cal_lm35Table},
+    {Cal_lm35Table},
+    {Cal_lm35Table}
+};
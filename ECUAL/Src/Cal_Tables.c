@@ -0,0 +1,69 @@
+/**
+ * @file Cal_Tables.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The sensor linearization tables in tenths of a degree, generated by water_heater_cal
+ *        from SIM/Include/CalGen_Cfg.h, run make cal after changing it instead of editing this file
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "Int.h"
+#include "Adc.h"
+#include "AdcSeq.h"
+#include "Cal.h"
+#include "Cal_Tables.h"
+
+/* LM35, 10 mV/C */
+const calTemperature_t Cal_lm35Table[CAL_TABLE_POINTS] = {
+    0, 78, 156, 234, 313, 391, 469, 547,
+    625, 703, 781, 859, 938, 1016, 1094, 1172,
+    1250, 1328, 1406, 1484, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500
+};
+
+/* 10k NTC, beta 3950 K, 10k series resistor */
+const calTemperature_t Cal_ntcBetaTable[CAL_TABLE_POINTS] = {
+    1500, 1500, 1293, 1127, 1016, 933, 866, 811,
+    763, 722, 685, 652, 621, 593, 567, 543,
+    520, 498, 477, 458, 439, 421, 403, 386,
+    370, 354, 338, 323, 308, 293, 278, 264,
+    250, 236, 222, 208, 194, 181, 167, 153,
+    139, 125, 111, 97, 83, 68, 53, 37,
+    22, 5, -11, -29, -47, -66, -87, -108,
+    -132, -157, -186, -218, -256, -302, -364, -400,
+    -400
+};
+
+/* 10k NTC, Steinhart-Hart, 10k series resistor */
+const calTemperature_t Cal_ntcSteinhartHartTable[CAL_TABLE_POINTS] = {
+    1500, 1500, 1397, 1219, 1098, 1007, 934, 874,
+    822, 776, 735, 698, 664, 633, 604, 577,
+    551, 527, 504, 482, 460, 440, 420, 401,
+    383, 364, 347, 329, 312, 296, 279, 263,
+    247, 231, 215, 199, 183, 168, 152, 136,
+    120, 104, 88, 71, 55, 38, 20, 2,
+    -16, -35, -54, -75, -96, -118, -142, -168,
+    -195, -226, -259, -298, -342, -398, -400, -400,
+    -400
+};
+
+/* PT1000, Callendar-Van Dusen, 1k series resistor */
+const calTemperature_t Cal_pt1000Table[CAL_TABLE_POINTS] = {
+    -400, -400, -400, -400, -400, -400, -400, -400,
+    -400, -400, -400, -400, -400, -400, -400, -400,
+    -400, -400, -400, -400, -400, -400, -400, -400,
+    -400, -400, -400, -400, -400, -400, -300, -155,
+    0, 165, 343, 534, 739, 961, 1202, 1465,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500, 1500, 1500, 1500, 1500, 1500, 1500, 1500,
+    1500
+};
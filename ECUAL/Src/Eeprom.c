@@ -1,26 +1,55 @@
 /**
  * @file Eeprom.c
  * @author Mark Attia (markjosephattia@gmail.com)
- * @brief This is the implementation for the EEPROM driver 
+ * @brief This is the implementation for the EEPROM driver
  * @version 0.1
  * @date 2020-07-05
- * 
+ *
  * @copyright Copyright (c) 2020
- * 
+ *
  */
 #include "Std_Types.h"
-#include "Eeprom.h"
 #include "I2c.h"
-/* Read Command With EEPROM Address */
-#define EEPROM_READ 0xA1
-/* Write Command With EEPROM Address */
-#define EEPROM_WRITE 0xA0
+#include "Eeprom.h"
+#include "Hw.h"
+/* The EEPROM Address, The Driver Sets The Read Bit */
+#define EEPROM_DEVICE_ADDRESS   0xA0
 /* Second Byte Shift */
 #define EEPROM_SECOND_BYTE      0x08
+/* The Bytes Of The Address */
+#define EEPROM_ADDRESS_SIZE     2
+#define EEPROM_PAGE_MASK        (EEPROM_PAGE_SIZE - 1)
+
+STD_STATIC_ASSERT((EEPROM_PAGE_SIZE & EEPROM_PAGE_MASK) == 0 && EEPROM_PAGE_SIZE <= 64, Eeprom_pageSizeCheck);
+STD_STATIC_ASSERT(EEPROM_REQUEST_SIZE <= EEPROM_PAGE_SIZE, Eeprom_requestSizeCheck);
+
+/* The Address And The Data Of A Page Write */
+static HW_INSTANCE uint8_t Eeprom_pageBuffer[EEPROM_ADDRESS_SIZE + EEPROM_PAGE_SIZE];
+
+/**
+ * @brief Runs a transaction and runs it again while the EEPROM does not acknowledge, up to EEPROM_ACK_POLLS times,
+ *        it does not acknowledge its address while it writes a page, only the waiting calls poll like this
+ *
+ * @param transaction The transaction
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the EEPROM did not acknowledge or the bus timed out, the status of the transaction tells which
+ */
+static Std_ReturnType Eeprom_Transfer(i2cTransaction_t* transaction)
+{
+    Std_ReturnType error;
+    uint8_t polls = 0;
+    do
+    {
+        error = I2c_Transfer(transaction);
+        polls++;
+    }while(E_OK != error && I2C_STATUS_NACK == transaction->status && polls < EEPROM_ACK_POLLS);
+    return error;
+}
 
 /**
  * @brief Initializes the EEPROM
- * 
+ *
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
  *                  E_NOT_OK : if the function is not executed correctly
@@ -32,65 +61,141 @@ Std_ReturnType Eeprom_Init(void)
 }
 /**
  * @brief Writes a byte to the EEPROM
- * 
+ *
  * @param address The address to write data in
  * @param data The data to write
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_NOT_OK : if the EEPROM did not acknowledge within EEPROM_ACK_POLLS tries or the bus timed out
  */
 Std_ReturnType Eeprom_WriteByte(Eeprom_Address_t address, uint8_t data)
 {
-    uint8_t ack;
-    /* I2C Start */
-    I2c_Start();
-    do
-    {
-        /* I2C Write Command In The Specified Address */
-        I2c_Write(&ack, EEPROM_WRITE);
-    }while(ack == I2C_NO_ACK);
-    /* I2C Write High Byte Of The Address */
-    I2c_Write(&ack, (uint8_t)(address>>EEPROM_SECOND_BYTE));
-    /* I2C Write Low Byte Of The Address */
-    I2c_Write(&ack, (uint8_t)address);
-    /* I2C Write The Data */
-    I2c_Write(&ack, data);
-    /* I2C Stop */
-    I2c_Stop();
-    return E_OK;
+    return Eeprom_WritePage(address, &data, 1);
 }
 /**
  * @brief Reads a byte from the EEPROM
- * 
+ *
  * @param address The address to read data from
  * @param data The data to read
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_NOT_OK : if the EEPROM did not acknowledge within EEPROM_ACK_POLLS tries or the bus timed out
  */
 Std_ReturnType Eeprom_ReadByte(Eeprom_Address_t address, uint8_t* data)
 {
-    uint8_t ack;
-    /* I2C Start */
-    I2c_Start();
-    do
+    return Eeprom_ReadBlock(address, data, 1);
+}
+/**
+ * @brief Writes bytes to the EEPROM with one page write per page they fall in, so a block inside
+ *        a page of EEPROM_PAGE_SIZE bytes takes one write cycle instead of one per byte
+ *
+ * @param address The address of the first byte
+ * @param data The data to write
+ * @param length The number of bytes, the addresses must not pass the end of the EEPROM
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the length is 0, or a page was not written, the pages after it are not written
+ */
+Std_ReturnType Eeprom_WritePage(Eeprom_Address_t address, const uint8_t* data, uint8_t length)
+{
+    Std_ReturnType error = (length) ? E_OK : E_NOT_OK;
+    i2cTransaction_t transaction = {EEPROM_DEVICE_ADDRESS, Eeprom_pageBuffer, 0, NULL, 0, NULL, I2C_STATUS_IDLE};
+    uint8_t size;
+    uint8_t i;
+    while(length && E_OK == error)
+    {
+        /* The Address Rolls Over Inside A Page, A Write Stops At The End Of Its Page */
+        size = EEPROM_PAGE_SIZE - (uint8_t)(address & EEPROM_PAGE_MASK);
+        if(size > length)
+        {
+            size = length;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        Eeprom_pageBuffer[0] = (uint8_t)(address>>EEPROM_SECOND_BYTE);
+        Eeprom_pageBuffer[1] = (uint8_t)address;
+        for(i=0; i<size; i++)
+        {
+            Eeprom_pageBuffer[EEPROM_ADDRESS_SIZE + i] = data[i];
+        }
+        transaction.writeLength = EEPROM_ADDRESS_SIZE + size;
+        error = Eeprom_Transfer(&transaction);
+        address += size;
+        data += size;
+        length -= size;
+    }
+    return error;
+}
+/**
+ * @brief Reads bytes from the EEPROM with one sequential read, every byte is acknowledged but the last
+ *
+ * @param address The address of the first byte
+ * @param data The data to read
+ * @param length The number of bytes
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the length is 0, or the EEPROM did not acknowledge within EEPROM_ACK_POLLS tries or the bus timed out
+ */
+Std_ReturnType Eeprom_ReadBlock(Eeprom_Address_t address, uint8_t* data, uint8_t length)
+{
+    Std_ReturnType error = E_NOT_OK;
+    /* The Address Is Written Then The Data Is Read After A Repeated Start, The Address Rolls Over At The End Of The EEPROM */
+    uint8_t buffer[EEPROM_ADDRESS_SIZE] = {(uint8_t)(address>>EEPROM_SECOND_BYTE), (uint8_t)address};
+    i2cTransaction_t transaction = {EEPROM_DEVICE_ADDRESS, buffer, EEPROM_ADDRESS_SIZE, data, length, NULL, I2C_STATUS_IDLE};
+    if(length)
+    {
+        error = Eeprom_Transfer(&transaction);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+/**
+ * @brief Writes bytes inside a page to the EEPROM without waiting, the data is copied to the request and
+ *        the call back gets the transaction when it completes
+ *        A write that is not acknowledged is not queued again, polling from the interrupt would keep the bus
+ *        busy for the whole write cycle, a status of I2C_STATUS_NACK means the EEPROM was busy or missing and
+ *        nothing was written, the caller tries again later, I2C_STATUS_TIMEOUT means the bus hung and was recovered,
+ *        I2C_STATUS_BUS_LOCKED that a slave still held SDA low after the recovery
+ *
+ * @param request The request, it must not be pending
+ * @param address The address of the first byte
+ * @param data The data to write
+ * @param length The number of bytes (1 .. EEPROM_REQUEST_SIZE), they must not pass the end of their page
+ * @param callBack The call back, called from the interrupt, or NULL
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the write is queued
+ *                  E_NOT_OK : if the length is not valid, the request is pending or the write could not be queued
+ */
+Std_ReturnType Eeprom_WriteAsync(eepromRequest_t* request, Eeprom_Address_t address, const uint8_t* data, uint8_t length, i2cCallBack_t callBack)
+{
+    Std_ReturnType error = E_NOT_OK;
+    uint8_t i;
+    /* The Buffer Of A Pending Request Is Still On The Bus */
+    if(length > 0 && length <= EEPROM_REQUEST_SIZE && (address & EEPROM_PAGE_MASK) + length <= EEPROM_PAGE_SIZE &&
+       I2C_STATUS_PENDING != request->transaction.status && I2C_STATUS_BUSY != request->transaction.status)
+    {
+        request->buffer[0] = (uint8_t)(address>>EEPROM_SECOND_BYTE);
+        request->buffer[1] = (uint8_t)address;
+        for(i=0; i<length; i++)
+        {
+            request->buffer[EEPROM_ADDRESS_SIZE + i] = data[i];
+        }
+        request->transaction.address = EEPROM_DEVICE_ADDRESS;
+        request->transaction.writeData = request->buffer;
+        request->transaction.writeLength = EEPROM_ADDRESS_SIZE + length;
+        request->transaction.readData = NULL;
+        request->transaction.readLength = 0;
+        request->transaction.callBack = callBack;
+        error = I2c_Submit(&request->transaction);
+    }
+    else
     {
-        /* I2C Write Command In The Specified Address */
-        I2c_Write(&ack, EEPROM_WRITE);
-    }while(ack == I2C_NO_ACK);
-    /* I2C Write High Byte Of The Address */
-    I2c_Write(&ack, (uint8_t)(address>>EEPROM_SECOND_BYTE));
-    /* I2C Write Low Byte Of The Address */
-    I2c_Write(&ack, (uint8_t)address);
-    /* I2C Start */
-    I2c_Start();
-    /* I2C Read Command At The Specified Address */
-    I2c_Write(&ack, EEPROM_READ);
-    /* I2C Write The Data */
-    I2c_Read(data);
-    /* I2C Send No Ack */
-    I2c_NACK();
-    /* I2C Stop */
-    I2c_Stop();
-    return E_OK;
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
 }
@@ -12,6 +12,7 @@
 #include "Gpio.h"
 #include "SSeg.h"
 #include "Sched.h"
+#include "Hw.h"
 
 /* The Numbers From 0 To 9 For The Anode */
 const char numsA[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x6F};
@@ -19,9 +20,9 @@ const char numsA[10] = {0x3F, 0x06, 0x5B, 0x4F, 0x66, 0x6D, 0x7D, 0x07, 0x7F, 0x
 const char numsC[10] = {0xC0, 0xF9, 0xA4, 0xB0, 0x99, 0x92, 0x82, 0xF8, 0x80, 0x90};
 
 extern const sseg_t SSeg_sseg;
-static volatile uint8_t SSeg_data[SSEG_NUMBER_OF_SSEGS];
+static HW_INSTANCE volatile uint8_t SSeg_data[SSEG_NUMBER_OF_SSEGS];
 
-static volatile SSeg_display_t SSeg_display = SSEG_OFF;
+static HW_INSTANCE volatile SSeg_display_t SSeg_display = SSEG_OFF;
 static Std_ReturnType SSeg_SetOn(SSeg_name_t name);
 static Std_ReturnType SSeg_SetOff(SSeg_name_t name);
 /**
@@ -137,7 +138,7 @@ Std_ReturnType SSeg_SetNum(SSeg_name_t name, uint8_t digit)
  */
 void SSeg_Runnable(void)
 {
-    static uint8_t sSegItr;
+    static HW_INSTANCE uint8_t sSegItr;
     uint8_t pinItr;
     /* Sets The Previous Display Off */
     if(sSegItr > 0)
@@ -184,4 +185,4 @@ void SSeg_Runnable(void)
     }
 }
 
-const task_t SSeg_task = {SSeg_Runnable, 25};
\ No newline at end of file
+const task_t SSeg_task = {SSeg_Runnable, SSEG_TASK_PERIOD_MS};
\ No newline at end of file
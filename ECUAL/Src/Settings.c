@@ -0,0 +1,395 @@
+/**
+ * @file Settings.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the implementation for the settings store, the records are written to the slots of the
+ *        region in turn with consecutive sequence numbers, so from slot 0 to the newest record the sequence
+ *        is the one of slot 0 plus the slot and the slots after it hold the previous lap or are erased,
+ *        the newest record is the last slot that keeps the rule and it is found by a binary search
+ *        A record is garbage once a newer one is written and its slot is reused on the next lap,
+ *        so the log never needs to be compacted
+ *        A commit never writes over the newest record, a write cut by a power loss leaves a record that
+ *        fails its CRC and the search stops at the record before it
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "I2c.h"
+#include "Eeprom.h"
+#include "Settings.h"
+#include "Hw.h"
+
+/* There Is No Record In The Region */
+#define SETTINGS_NO_SLOT                    0xFFFF
+/* The Sequence Numbers Go Round Below 0xFFFF, An Erased Record Has No Sequence Number */
+#define SETTINGS_SEQUENCE_ERASED            0xFFFF
+#define SETTINGS_SEQUENCE_MODULO            0xFFFF
+/* The Bytes Of A Record, The Bytes Between The Values And The CRC Are Left Erased */
+#define SETTINGS_SEQUENCE_HIGH              0
+#define SETTINGS_SEQUENCE_LOW               1
+#define SETTINGS_VALUES                     2
+#define SETTINGS_CRC                        (SETTINGS_RECORD_SIZE - 1)
+#define SETTINGS_ERASED                     0xFF
+/* The CRC-8 Of SAE J1850 (Polynomial 0x1D), Starting From 0xFF Keeps A Record Of Zeros From Being Valid */
+#define SETTINGS_CRC_INITIAL                0xFF
+#define SETTINGS_CRC_FINAL                  0xFF
+
+#define SETTINGS_SEQUENCE(record)           (((uint16_t)(record)[SETTINGS_SEQUENCE_HIGH] << 8) | (record)[SETTINGS_SEQUENCE_LOW])
+#define SETTINGS_NEXT_SEQUENCE(sequence, n) ((uint16_t)(((uint32_t)(sequence) + (n)) % SETTINGS_SEQUENCE_MODULO))
+
+/* A Record Is Written In One Request Inside A Page */
+STD_STATIC_ASSERT((SETTINGS_RECORD_SIZE & (SETTINGS_RECORD_SIZE - 1)) == 0 && SETTINGS_RECORD_SIZE <= EEPROM_REQUEST_SIZE, Settings_recordSizeCheck);
+STD_STATIC_ASSERT(SETTINGS_VALUES + SETTINGS_NUMBER_OF_SETTINGS < SETTINGS_RECORD_SIZE, Settings_recordValuesCheck);
+STD_STATIC_ASSERT((SETTINGS_SLOT_SIZE & (SETTINGS_SLOT_SIZE - 1)) == 0 && SETTINGS_SLOT_SIZE >= SETTINGS_RECORD_SIZE, Settings_slotSizeCheck);
+STD_STATIC_ASSERT(SETTINGS_REGION_ADDRESS % EEPROM_PAGE_SIZE == 0, Settings_regionAlignmentCheck);
+STD_STATIC_ASSERT(SETTINGS_NUMBER_OF_SLOTS >= 2 && SETTINGS_NUMBER_OF_SLOTS < SETTINGS_NO_SLOT, Settings_slotsCheck);
+
+/* The Table Of The CRC, A Byte Per Step Instead Of A Bit, It Stays In The Program Memory */
+static const uint8_t Settings_crcTable[256] = {
+    0x00, 0x1D, 0x3A, 0x27, 0x74, 0x69, 0x4E, 0x53, 0xE8, 0xF5, 0xD2, 0xCF, 0x9C, 0x81, 0xA6, 0xBB,
+    0xCD, 0xD0, 0xF7, 0xEA, 0xB9, 0xA4, 0x83, 0x9E, 0x25, 0x38, 0x1F, 0x02, 0x51, 0x4C, 0x6B, 0x76,
+    0x87, 0x9A, 0xBD, 0xA0, 0xF3, 0xEE, 0xC9, 0xD4, 0x6F, 0x72, 0x55, 0x48, 0x1B, 0x06, 0x21, 0x3C,
+    0x4A, 0x57, 0x70, 0x6D, 0x3E, 0x23, 0x04, 0x19, 0xA2, 0xBF, 0x98, 0x85, 0xD6, 0xCB, 0xEC, 0xF1,
+    0x13, 0x0E, 0x29, 0x34, 0x67, 0x7A, 0x5D, 0x40, 0xFB, 0xE6, 0xC1, 0xDC, 0x8F, 0x92, 0xB5, 0xA8,
+    0xDE, 0xC3, 0xE4, 0xF9, 0xAA, 0xB7, 0x90, 0x8D, 0x36, 0x2B, 0x0C, 0x11, 0x42, 0x5F, 0x78, 0x65,
+    0x94, 0x89, 0xAE, 0xB3, 0xE0, 0xFD, 0xDA, 0xC7, 0x7C, 0x61, 0x46, 0x5B, 0x08, 0x15, 0x32, 0x2F,
+    0x59, 0x44, 0x63, 0x7E, 0x2D, 0x30, 0x17, 0x0A, 0xB1, 0xAC, 0x8B, 0x96, 0xC5, 0xD8, 0xFF, 0xE2,
+    0x26, 0x3B, 0x1C, 0x01, 0x52, 0x4F, 0x68, 0x75, 0xCE, 0xD3, 0xF4, 0xE9, 0xBA, 0xA7, 0x80, 0x9D,
+    0xEB, 0xF6, 0xD1, 0xCC, 0x9F, 0x82, 0xA5, 0xB8, 0x03, 0x1E, 0x39, 0x24, 0x77, 0x6A, 0x4D, 0x50,
+    0xA1, 0xBC, 0x9B, 0x86, 0xD5, 0xC8, 0xEF, 0xF2, 0x49, 0x54, 0x73, 0x6E, 0x3D, 0x20, 0x07, 0x1A,
+    0x6C, 0x71, 0x56, 0x4B, 0x18, 0x05, 0x22, 0x3F, 0x84, 0x99, 0xBE, 0xA3, 0xF0, 0xED, 0xCA, 0xD7,
+    0x35, 0x28, 0x0F, 0x12, 0x41, 0x5C, 0x7B, 0x66, 0xDD, 0xC0, 0xE7, 0xFA, 0xA9, 0xB4, 0x93, 0x8E,
+    0xF8, 0xE5, 0xC2, 0xDF, 0x8C, 0x91, 0xB6, 0xAB, 0x10, 0x0D, 0x2A, 0x37, 0x64, 0x79, 0x5E, 0x43,
+    0xB2, 0xAF, 0x88, 0x95, 0xC6, 0xDB, 0xFC, 0xE1, 0x5A, 0x47, 0x60, 0x7D, 0x2E, 0x33, 0x14, 0x09,
+    0x7F, 0x62, 0x45, 0x58, 0x0B, 0x16, 0x31, 0x2C, 0x97, 0x8A, 0xAD, 0xB0, 0xE3, 0xFE, 0xD9, 0xC4
+};
+
+extern const settingsValue_t Settings_defaults[SETTINGS_NUMBER_OF_SETTINGS];
+static HW_INSTANCE settingsValue_t Settings_values[SETTINGS_NUMBER_OF_SETTINGS];
+/* The Slot And The Sequence Number Of The Newest Record */
+static HW_INSTANCE uint16_t Settings_head;
+static HW_INSTANCE uint16_t Settings_sequence;
+/* The Slot Being Written, SETTINGS_NO_SLOT Between The Writes */
+static HW_INSTANCE uint16_t Settings_pendingSlot;
+static HW_INSTANCE eepromRequest_t Settings_request;
+/* A Setting Changed Since The Last Record */
+static HW_INSTANCE volatile uint8_t Settings_dirty;
+/* The Head Was Found, A Commit Without It Could Write Over The Newest Record */
+static HW_INSTANCE uint8_t Settings_scanned;
+
+/**
+ * @brief Gives the CRC of the bytes of a record before its CRC
+ *
+ * @param record The record
+ * @return uint8_t The CRC
+ */
+static uint8_t Settings_Crc(const uint8_t* record)
+{
+    uint8_t crc = SETTINGS_CRC_INITIAL;
+    uint8_t i;
+    for(i=0; i<SETTINGS_CRC; i++)
+    {
+        crc = Settings_crcTable[crc ^ record[i]];
+    }
+    return crc ^ SETTINGS_CRC_FINAL;
+}
+
+/**
+ * @brief Reads the record of a slot and checks it
+ *
+ * @param slot The slot
+ * @param record The record
+ * @param valid 1 if the record has a sequence number and its CRC matches
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the EEPROM could not be read
+ */
+static Std_ReturnType Settings_Read(uint16_t slot, uint8_t* record, uint8_t* valid)
+{
+    Std_ReturnType error = Eeprom_ReadBlock(SETTINGS_REGION_ADDRESS + slot * SETTINGS_SLOT_SIZE, record, SETTINGS_RECORD_SIZE);
+    *valid = (E_OK == error && SETTINGS_SEQUENCE_ERASED != SETTINGS_SEQUENCE(record) && Settings_Crc(record) == record[SETTINGS_CRC]);
+    return error;
+}
+
+/**
+ * @brief The completion of the write of a record, called from the I2C interrupt
+ *
+ * @param transaction The write
+ */
+static void Settings_Written(i2cTransaction_t* transaction)
+{
+    if(I2C_STATUS_DONE == transaction->status)
+    {
+        Settings_sequence = (SETTINGS_NO_SLOT == Settings_head) ? 0 : SETTINGS_NEXT_SEQUENCE(Settings_sequence, 1);
+        Settings_head = Settings_pendingSlot;
+    }
+    else
+    {
+        /* The Head Did Not Move, So The Newest Intact Record Is Kept And The Next Commit Writes The Same Slot
+         * Again With The Same Sequence Number, Over What Is Left Of This Write */
+        Settings_dirty = 1;
+    }
+    Settings_pendingSlot = SETTINGS_NO_SLOT;
+}
+
+/**
+ * @brief Takes a valid record as the newest one
+ *
+ * @param slot The slot of the record
+ * @param record The record
+ * @param newest The copy of the newest record
+ */
+static void Settings_Take(uint16_t slot, const uint8_t* record, uint8_t* newest)
+{
+    uint8_t i;
+    Settings_head = slot;
+    Settings_sequence = SETTINGS_SEQUENCE(record);
+    for(i=0; i<SETTINGS_RECORD_SIZE; i++)
+    {
+        newest[i] = record[i];
+    }
+}
+
+/**
+ * @brief Finds the slot and the sequence number of the newest valid record of the log,
+ *        it reads 1 + log2(SETTINGS_NUMBER_OF_SLOTS) records, 2 for the A/B pair
+ *
+ * @param newest The newest record, if the head is found
+ * @return Std_ReturnType
+ *                 E_OK : if the log is read, the head is SETTINGS_NO_SLOT if it is empty
+ *                 E_NOT_OK : if the EEPROM could not be read, the head is not known
+ */
+static Std_ReturnType Settings_Scan(uint8_t* newest)
+{
+    Std_ReturnType error;
+    uint8_t record[SETTINGS_RECORD_SIZE];
+    uint8_t valid;
+    uint16_t first;
+    uint16_t low;
+    uint16_t high;
+    uint16_t middle;
+    Settings_head = SETTINGS_NO_SLOT;
+    Settings_sequence = 0;
+    error = Settings_Read(0, record, &valid);
+    if(valid)
+    {
+        /* Slot 0 Keeps The Rule, The Newest Record Is Between It And The Last Slot, Every Record
+         * That Keeps The Rule Is Kept So The Newest One Is Not Read Again */
+        Settings_Take(0, record, newest);
+        first = Settings_sequence;
+        low = 0;
+        high = SETTINGS_NUMBER_OF_SLOTS;
+        while(high - low > 1 && E_OK == error)
+        {
+            middle = low + (high - low) / 2;
+            error = Settings_Read(middle, record, &valid);
+            if(valid && SETTINGS_SEQUENCE(record) == SETTINGS_NEXT_SEQUENCE(first, middle))
+            {
+                low = middle;
+                Settings_Take(middle, record, newest);
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+    }
+    else if(E_OK == error)
+    {
+        /* The Log Is Empty, Or The Write Of Slot 0 Was Cut Short After A Whole Lap And The Last Slot Is The Newest */
+        error = Settings_Read(SETTINGS_NUMBER_OF_SLOTS - 1, record, &valid);
+        if(valid)
+        {
+            Settings_Take(SETTINGS_NUMBER_OF_SLOTS - 1, record, newest);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Loads the settings from the newest valid record of the log, the settings without a record
+ *        take their values of Settings_Cfg.c, the EEPROM must be initialized first
+ *        The log is read up to SETTINGS_SCAN_TRIES times
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the EEPROM could not be read, the settings take their values of Settings_Cfg.c
+ *                            and the commits read the log again before they write
+ */
+Std_ReturnType Settings_Init(void)
+{
+    Std_ReturnType error;
+    uint8_t newest[SETTINGS_RECORD_SIZE];
+    uint8_t tries = 0;
+    uint8_t i;
+    Settings_dirty = 0;
+    Settings_pendingSlot = SETTINGS_NO_SLOT;
+    Settings_request.transaction.status = I2C_STATUS_IDLE;
+    do
+    {
+        error = Settings_Scan(newest);
+        tries++;
+    }while(E_OK != error && tries < SETTINGS_SCAN_TRIES);
+    Settings_scanned = (E_OK == error);
+    for(i=0; i<SETTINGS_NUMBER_OF_SETTINGS; i++)
+    {
+        Settings_values[i] = (Settings_scanned && SETTINGS_NO_SLOT != Settings_head) ? newest[SETTINGS_VALUES + i] : Settings_defaults[i];
+    }
+    return error;
+}
+
+/**
+ * @brief Gets the value of a setting
+ *
+ * @param key The setting
+ * @param value The value
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the setting is not configured
+ */
+Std_ReturnType Settings_Get(settingsKey_t key, settingsValue_t* value)
+{
+    Std_ReturnType error = E_NOT_OK;
+    if(key < SETTINGS_NUMBER_OF_SETTINGS)
+    {
+        *value = Settings_values[key];
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Sets the value of a setting, it is saved by the next commit
+ *
+ * @param key The setting
+ * @param value The value
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the setting is not configured
+ */
+Std_ReturnType Settings_Set(settingsKey_t key, settingsValue_t value)
+{
+    Std_ReturnType error = E_NOT_OK;
+    if(key < SETTINGS_NUMBER_OF_SETTINGS)
+    {
+        /* The Same Value Does Not Take A Record */
+        if(Settings_values[key] != value)
+        {
+            Settings_values[key] = value;
+            Settings_dirty = 1;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Queues the write of a record with the settings if one changed since the last record, it completes
+ *        in the I2C interrupt and the settings stay changed until it succeeds
+ *        If the log could not be read by Settings_Init it is read here first, waiting for the bus
+ *
+ * @return Std_ReturnType
+ *                 E_OK : if the record is queued or nothing changed
+ *                 E_NOT_OK : if the last record is still being written, the log could not be read or the record could not be queued
+ */
+Std_ReturnType Settings_Commit(void)
+{
+    Std_ReturnType error = E_OK;
+    uint8_t record[SETTINGS_RECORD_SIZE];
+    uint16_t sequence;
+    uint8_t i;
+    if(I2C_STATUS_PENDING == Settings_request.transaction.status || I2C_STATUS_BUSY == Settings_request.transaction.status)
+    {
+        error = E_NOT_OK;
+    }
+    else if(Settings_dirty && !Settings_scanned)
+    {
+        /* The Settings In RAM Are Newer Than The Log, Only Its Head Is Needed */
+        error = Settings_Scan(record);
+        Settings_scanned = (E_OK == error);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(E_OK == error && Settings_dirty)
+    {
+        /* The Next Slot With The Next Sequence Number, An Empty Log Starts At Slot 0 */
+        if(SETTINGS_NO_SLOT == Settings_head)
+        {
+            Settings_pendingSlot = 0;
+            sequence = 0;
+        }
+        else
+        {
+            Settings_pendingSlot = (Settings_head + 1) % SETTINGS_NUMBER_OF_SLOTS;
+            sequence = SETTINGS_NEXT_SEQUENCE(Settings_sequence, 1);
+        }
+        record[SETTINGS_SEQUENCE_HIGH] = (uint8_t)(sequence >> 8);
+        record[SETTINGS_SEQUENCE_LOW] = (uint8_t)sequence;
+        for(i=SETTINGS_VALUES; i<SETTINGS_CRC; i++)
+        {
+            record[i] = (i < SETTINGS_VALUES + SETTINGS_NUMBER_OF_SETTINGS) ? Settings_values[i - SETTINGS_VALUES] : SETTINGS_ERASED;
+        }
+        record[SETTINGS_CRC] = Settings_Crc(record);
+        Settings_dirty = 0;
+        error = Eeprom_WriteAsync(&Settings_request, SETTINGS_REGION_ADDRESS + Settings_pendingSlot * SETTINGS_SLOT_SIZE, record, SETTINGS_RECORD_SIZE, Settings_Written);
+        if(E_OK != error)
+        {
+            Settings_pendingSlot = SETTINGS_NO_SLOT;
+            Settings_dirty = 1;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Tells if a setting is not in an intact record yet, because it changed since the last commit,
+ *        its record is still being written or the write failed, the caller commits again until it is not
+ *
+ * @return uint8_t 1 if the settings are not saved, 0 if they are
+ */
+uint8_t Settings_IsDirty(void)
+{
+    uint8_t dirty = 1;
+    /* The Status Is Read First, The Interrupt Sets It And Then Marks A Failed Write Dirty In The Call Back */
+    if(I2C_STATUS_PENDING != Settings_request.transaction.status && I2C_STATUS_BUSY != Settings_request.transaction.status)
+    {
+        dirty = Settings_dirty;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return dirty;
+}
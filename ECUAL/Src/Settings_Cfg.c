@@ -0,0 +1,20 @@
+/**
+ * @file  Settings_Cfg.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief These are the configurations for the settings store
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "I2c.h"
+#include "Eeprom.h"
+#include "Settings.h"
+
+/* The Values Of The Settings Before They Are First Saved */
+const settingsValue_t Settings_defaults[SETTINGS_NUMBER_OF_SETTINGS] = {
+    /* The Initial Temprature Of The Water Heater */
+    60
+};
@@ -10,9 +10,10 @@
 #include "Gpio.h"
 #include "Switch.h"
 #include "Sched.h"
+#include "Hw.h"
 
 extern const switch_t Switch_switches[SWITCH_NUMBER_OF_SWITCHES];
-static Switch_State_t Switch_state[SWITCH_NUMBER_OF_SWITCHES];
+static HW_INSTANCE Switch_State_t Switch_state[SWITCH_NUMBER_OF_SWITCHES];
 
 /**
  * Function:  Switch_Init 
@@ -74,8 +75,8 @@ Std_ReturnType Switch_GetSwitchStatus(Switch_Name_t switchName, Switch_State_t*
 static void Switch_Runnable(void)
 {
     uint8_t i,readVal;
-    static uint8_t prevState[SWITCH_NUMBER_OF_SWITCHES];
-    static uint8_t counter[SWITCH_NUMBER_OF_SWITCHES];
+    static HW_INSTANCE uint8_t prevState[SWITCH_NUMBER_OF_SWITCHES];
+    static HW_INSTANCE uint8_t counter[SWITCH_NUMBER_OF_SWITCHES];
     uint8_t currentState;
     /* Gets The Status Of Each Switch */
     for(i=0; i<SWITCH_NUMBER_OF_SWITCHES; i++)
@@ -91,7 +92,7 @@ static void Switch_Runnable(void)
             counter[i] = 0;
         }
         /* If State Settled */
-        if(counter[i] == 5)
+        if(counter[i] == SWITCH_DEBOUNCE_SAMPLES)
         {
             Switch_state[i] = currentState;
             counter[i] = 0;
@@ -106,4 +107,4 @@ static void Switch_Runnable(void)
 
 }
 
-const task_t Switch_task = {Switch_Runnable, 5}; 
\ No newline at end of file
+const task_t Switch_task = {Switch_Runnable, SWITCH_TASK_PERIOD_MS}; 
\ No newline at end of file
@@ -1,8 +1,10 @@
 #ifndef CFG_H_
 #define CFG_H_
 
+/* The Configuration Bits Only Exist On The Target */
+#ifndef HW_HOST
 #pragma config FOSC = HS        // Oscillator Selection bits (HS oscillator)
-#pragma config WDTE = OFF       // Watchdog Timer Enable bit (WDT disabled)
+#pragma config WDTE = ON        // Watchdog Timer Enable bit (WDT enabled, cleared by the scheduler supervision)
 #pragma config PWRTE = ON       // Power-up Timer Enable bit (PWRT enabled)
 #pragma config BOREN = ON       // Brown-out Reset Enable bit (BOR enabled)
 #pragma config LVP = OFF        // Low-Voltage (Single-Supply) In-Circuit Serial Programming Enable bit (RB3 is digital I/O, HV on MCLR must be used for programming)
@@ -11,5 +13,6 @@
 #pragma config CP = OFF         // Flash Program Memory Code Protection bit (Code protection off)
 
 #include <xc.h>
+#endif
 
 #endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+/**
+ * @file Filter.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the user interface for the reading filters, a moving average over a window with a running sum
+ *        or an exponential moving average, both take O(1) per sample and give fixed point values, and a trimmed
+ *        mean or median over a sorted window that rejects outliers
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef FILTER_H_
+#define FILTER_H_
+
+/* The Filter Modes */
+/* The Mean Of The Last size Samples, The Sum Adds The New Sample And Subtracts The Evicted One */
+#define FILTER_MODE_AVERAGE                 0
+/* The Exponential Moving Average With A Weight Of 1 / 2^size For The New Sample */
+#define FILTER_MODE_EMA                     1
+/* The Mean Of The Last size Samples Without The trim Lowest And The trim Highest Ones, A Sorted Copy Of The Window
+ * Is Kept By Insertion, Up To size Moves Per Sample Which Beats A Heap For The Short Windows Of The Sensors,
+ * A Read Takes trim Steps And The Median Reads The Middle Samples */
+#define FILTER_MODE_TRIMMED                 2
+
+/* The Trim Of The Median, The Middle Sample Or The Mean Of The Two Middle Samples */
+#define FILTER_MEDIAN                       0xFF
+
+/* The Longest Window And The Largest Weight Shift */
+#define FILTER_MAX_WINDOW                   255
+#define FILTER_MAX_EMA_SHIFT                8
+
+typedef uint16_t filterSample_t;
+
+typedef struct
+{
+    /* The Window Of The Average And Trimmed Modes In The Order Of The Samples, Not Used By The EMA Mode */
+    filterSample_t* window;
+    /* The Samples Of The Window In Ascending Order, Only Used By The Trimmed Mode */
+    filterSample_t* sorted;
+    /* The Sum Of The Window, Or The EMA Scaled By 2^size */
+    uint32_t sum;
+    /* The Window Size Or The EMA Shift */
+    uint8_t size;
+    /* The Samples Trimmed From Each End In The Trimmed Mode */
+    uint8_t trim;
+    /* The Slot Of The Next Sample */
+    uint8_t index;
+    /* The Samples In The Window, Or 1 Once The EMA Started */
+    uint8_t count;
+    uint8_t mode;
+} filter_t;
+
+/**
+ * @brief Initializes a filter without samples
+ *
+ * @param filter The filter
+ * @param mode The filter mode
+ *                 @arg FILTER_MODE_AVERAGE
+ *                 @arg FILTER_MODE_EMA
+ * @param window The window of size samples for the average mode, NULL for the EMA mode
+ * @param size The window size (1 .. FILTER_MAX_WINDOW) or the EMA shift (0 .. FILTER_MAX_EMA_SHIFT)
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the mode, the window or the size is not valid
+ */
+extern Std_ReturnType Filter_Init(filter_t* filter, uint8_t mode, filterSample_t* window, uint8_t size);
+
+/**
+ * @brief Initializes a trimmed mean or median filter without samples, a window that is not full yet
+ *        is trimmed by up to half of its samples
+ *
+ * @param filter The filter
+ * @param window The window of size samples
+ * @param sorted The sorted copy of the window, size samples
+ * @param size The window size (1 .. FILTER_MAX_WINDOW)
+ * @param trim The samples trimmed from each end, less than half of the size, or FILTER_MEDIAN
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if a window, the size or the trim is not valid
+ */
+extern Std_ReturnType Filter_InitTrimmed(filter_t* filter, filterSample_t* window, filterSample_t* sorted, uint8_t size, uint8_t trim);
+
+/**
+ * @brief Adds a sample to a filter
+ *
+ * @param filter The filter
+ * @param sample The sample
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Filter_Add(filter_t* filter, filterSample_t sample);
+
+/**
+ * @brief Gets the filtered value scaled by scale / divisor and rounded, for example the value in tenths
+ *        of a degree is given by a scale of 10 and a divisor of the counts per degree
+ *
+ * @param filter The filter
+ * @param scale The scale
+ * @param divisor The divisor
+ * @param value The scaled value
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the filter has no samples yet or the divisor is 0
+ */
+extern Std_ReturnType Filter_GetValue(const filter_t* filter, uint16_t scale, uint16_t divisor, uint16_t* value);
+
+#endif
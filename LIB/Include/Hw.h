@@ -0,0 +1,25 @@
+/**
+ * @file Hw.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The hardware access layer, every special function register access goes through here
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef HW_H_
+#define HW_H_
+
+/* Select The Register Backend, The Host Build Defines HW_HOST */
+#ifdef HW_HOST
+#include "Hw_Host.h"
+#else
+#include "Hw_Pic16f877a.h"
+#endif
+
+/* 16-Bit Registers Are A Low Byte Followed By A High Byte */
+#define HW_READ16(address)              ((uint16_t)HW_READ8(address) | ((uint16_t)HW_READ8((address) + 1) << 8))
+#define HW_WRITE16(address, value)      do { HW_WRITE8((address), (uint8_t)(value)); HW_WRITE8((address) + 1, (uint8_t)((uint16_t)(value) >> 8)); } while(0)
+
+#endif
@@ -0,0 +1,41 @@
+/**
+ * @file Hw_Pic16f877a.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The PIC16F877A register backend for the hardware access layer
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef HW_PIC16F877A_H_
+#define HW_PIC16F877A_H_
+
+/* The Registers Are Accessed Directly In The Data Memory */
+#define HW_READ8(address)               (*(volatile uint8_t*)(address))
+#define HW_WRITE8(address, value)       (*(volatile uint8_t*)(address) = (uint8_t)(value))
+#define HW_OR8(address, mask)           (*(volatile uint8_t*)(address) |= (uint8_t)(mask))
+#define HW_AND8(address, mask)          (*(volatile uint8_t*)(address) &= (uint8_t)(mask))
+
+/* The Interrupt Service Routine Qualifier */
+#define HW_INTERRUPT                    __interrupt()
+
+/* The Core Keeps Running While Waiting For The Next Interrupt, The PIC16F877A Has No Idle Mode And SLEEP
+ * Stops The Instruction Clock That Drives The Timer 1 Compare Of The Scheduler. SCHED_SLEEP Sleeps On The
+ * Timer 1 Crystal Instead, See Timer1_Sleep */
+#define HW_IDLE()
+
+/* Stops The Instruction Clock Until An Enabled Interrupt Flag Is Set, The Global Interrupt Does Not Have To Be Enabled,
+ * The Instruction After SLEEP Is Fetched Before It */
+#define HW_SLEEP()                      do { asm("sleep"); asm("nop"); } while(0)
+
+/* There Is One Instance Of The Firmware State */
+#define HW_INSTANCE
+
+/* The Variables The Startup Code Does Not Clear, They Keep Their Value Through A Watchdog Reset */
+#define HW_PERSISTENT                   __persistent
+
+/* Clears The Watchdog Timer */
+#define HW_CLEAR_WATCHDOG()             asm("clrwdt")
+
+#endif
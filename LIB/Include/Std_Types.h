@@ -11,6 +11,24 @@
 #ifndef STD_TYPES_H
 #define STD_TYPES_H
 
+#ifdef HW_HOST
+/* The Host Compiler Has Its Own Widths, So Take The Exact Ones From The C Library */
+#include <stddef.h>
+#include <stdint.h>
+
+typedef uint8_t                         u8;
+typedef int8_t                          s8;
+typedef int8_t                          sint8_t;
+typedef uint16_t                        u16;
+typedef int16_t                         s16;
+typedef int16_t                         sint16_t;
+typedef uint32_t                        u32;
+typedef int32_t                         s32;
+typedef int32_t                         sint32_t;
+typedef uint64_t                        u64;
+typedef int64_t                         s64;
+typedef int64_t                         sint64_t;
+#else
 #define NULL                            ((void*)0)
 
 typedef unsigned char                   u8;
@@ -29,6 +47,7 @@ typedef unsigned long long int          u64;
 typedef unsigned long long int          uint64_t;
 typedef signed long long int            s64;
 typedef signed long long int            sint64_t;
+#endif
 
 typedef float                           f32;
 typedef float                           float32_t;
@@ -49,4 +68,7 @@ typedef uint8_t Std_ReturnType;
 #define STD_OFF                         (0)
 #define STD_ON                          (1)
 
-#endif
\ No newline at end of file
+/* Stops The Build When A Constant Condition Is False, The Array Size Is Negative */
+#define STD_STATIC_ASSERT(cond, name)   typedef char name[(cond) ? 1 : -1]
+
+#endif
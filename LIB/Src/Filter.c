@@ -0,0 +1,285 @@
+/**
+ * @file Filter.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the implementation for the reading filters
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include "Std_Types.h"
+#include "Filter.h"
+
+/**
+ * @brief Finds the first sorted sample that is not below a sample
+ *
+ * @param sorted The sorted samples
+ * @param count The number of samples
+ * @param sample The sample
+ * @return uint8_t The position, count if all the samples are below it
+ */
+static uint8_t Filter_LowerBound(const filterSample_t* sorted, uint8_t count, filterSample_t sample)
+{
+    uint8_t low = 0;
+    uint8_t high = count;
+    uint8_t middle;
+    while(low < high)
+    {
+        middle = low + (uint8_t)((high - low) >> 1);
+        if(sorted[middle] < sample)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/**
+ * @brief Puts a sample into the sorted window of a trimmed filter, in place of the evicted sample once the window is full,
+ *        the samples between the evicted and the new one move by one place so a sample costs up to size moves
+ *
+ * @param filter The filter
+ * @param sample The sample
+ */
+static void Filter_Sort(filter_t* filter, filterSample_t sample)
+{
+    filterSample_t* sorted = filter->sorted;
+    uint8_t position;
+    uint8_t i;
+    if(filter->count == filter->size)
+    {
+        /* The Slot Of The Evicted Sample Moves To The Place Of The New One */
+        position = Filter_LowerBound(sorted, filter->count, filter->window[filter->index]);
+        while(position > 0 && sorted[position - 1] > sample)
+        {
+            sorted[position] = sorted[position - 1];
+            position--;
+        }
+        while(position + 1 < filter->count && sorted[position + 1] < sample)
+        {
+            sorted[position] = sorted[position + 1];
+            position++;
+        }
+    }
+    else
+    {
+        position = Filter_LowerBound(sorted, filter->count, sample);
+        for(i=filter->count; i>position; i--)
+        {
+            sorted[i] = sorted[i - 1];
+        }
+    }
+    sorted[position] = sample;
+}
+
+/**
+ * @brief Initializes a filter without samples
+ *
+ * @param filter The filter
+ * @param mode The filter mode
+ *                 @arg FILTER_MODE_AVERAGE
+ *                 @arg FILTER_MODE_EMA
+ * @param window The window of size samples for the average mode, NULL for the EMA mode
+ * @param size The window size (1 .. FILTER_MAX_WINDOW) or the EMA shift (0 .. FILTER_MAX_EMA_SHIFT)
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the mode, the window or the size is not valid
+ */
+Std_ReturnType Filter_Init(filter_t* filter, uint8_t mode, filterSample_t* window, uint8_t size)
+{
+    Std_ReturnType error = E_OK;
+    if(FILTER_MODE_AVERAGE == mode)
+    {
+        error = (NULL == window || 0 == size) ? E_NOT_OK : E_OK;
+    }
+    else if(FILTER_MODE_EMA == mode)
+    {
+        error = (size > FILTER_MAX_EMA_SHIFT) ? E_NOT_OK : E_OK;
+    }
+    else
+    {
+        error = E_NOT_OK;
+    }
+    if(E_OK == error)
+    {
+        filter->window = window;
+        filter->sorted = NULL;
+        filter->sum = 0;
+        filter->size = size;
+        filter->trim = 0;
+        filter->index = 0;
+        filter->count = 0;
+        filter->mode = mode;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Initializes a trimmed mean or median filter without samples, a window that is not full yet
+ *        is trimmed by up to half of its samples
+ *
+ * @param filter The filter
+ * @param window The window of size samples
+ * @param sorted The sorted copy of the window, size samples
+ * @param size The window size (1 .. FILTER_MAX_WINDOW)
+ * @param trim The samples trimmed from each end, less than half of the size, or FILTER_MEDIAN
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if a window, the size or the trim is not valid
+ */
+Std_ReturnType Filter_InitTrimmed(filter_t* filter, filterSample_t* window, filterSample_t* sorted, uint8_t size, uint8_t trim)
+{
+    Std_ReturnType error = E_NOT_OK;
+    if(NULL != window && NULL != sorted && size > 0 && (FILTER_MEDIAN == trim || 2 * (uint16_t)trim < size))
+    {
+        filter->window = window;
+        filter->sorted = sorted;
+        filter->sum = 0;
+        filter->size = size;
+        filter->trim = trim;
+        filter->index = 0;
+        filter->count = 0;
+        filter->mode = FILTER_MODE_TRIMMED;
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Adds a sample to a filter
+ *
+ * @param filter The filter
+ * @param sample The sample
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Filter_Add(filter_t* filter, filterSample_t sample)
+{
+    if(FILTER_MODE_EMA == filter->mode)
+    {
+        if(filter->count)
+        {
+            /* sum / 2^size Moves By (sample - sum / 2^size) / 2^size */
+            filter->sum = filter->sum - (filter->sum >> filter->size) + sample;
+        }
+        else
+        {
+            /* The First Sample Starts The Average */
+            filter->sum = (uint32_t)sample << filter->size;
+            filter->count = 1;
+        }
+    }
+    else
+    {
+        if(FILTER_MODE_TRIMMED == filter->mode)
+        {
+            /* The Sorted Window Is Updated While The Evicted Sample Is Still In The Window */
+            Filter_Sort(filter, sample);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        /* The Sample In The Slot Leaves The Window Once It Is Full */
+        if(filter->count == filter->size)
+        {
+            filter->sum -= filter->window[filter->index];
+        }
+        else
+        {
+            filter->count++;
+        }
+        filter->window[filter->index] = sample;
+        filter->sum += sample;
+        filter->index++;
+        if(filter->index == filter->size)
+        {
+            filter->index = 0;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return E_OK;
+}
+
+/**
+ * @brief Gets the filtered value scaled by scale / divisor and rounded, for example the value in tenths
+ *        of a degree is given by a scale of 10 and a divisor of the counts per degree
+ *        The sum of the filter times the scale has to fit 32 bits
+ *
+ * @param filter The filter
+ * @param scale The scale
+ * @param divisor The divisor
+ * @param value The scaled value
+ * @return Std_ReturnType
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the filter has no samples yet or the divisor is 0
+ */
+Std_ReturnType Filter_GetValue(const filter_t* filter, uint16_t scale, uint16_t divisor, uint16_t* value)
+{
+    Std_ReturnType error = E_NOT_OK;
+    uint32_t denominator;
+    uint32_t sum = filter->sum;
+    uint8_t middle = filter->count / 2;
+    uint8_t i;
+    if(filter->count && divisor)
+    {
+        if(FILTER_MODE_EMA == filter->mode)
+        {
+            /* The Sum Is The Average Scaled By 2^size */
+            denominator = (uint32_t)divisor << filter->size;
+        }
+        else if(FILTER_MODE_TRIMMED == filter->mode && (FILTER_MEDIAN == filter->trim || 2 * (uint16_t)filter->trim >= filter->count))
+        {
+            /* The Median Is Read From The Middle Of The Sorted Window, A Window That Is Not Full Falls Back To It */
+            sum = filter->sorted[middle];
+            denominator = divisor;
+            if(0 == (filter->count & 1))
+            {
+                /* The Mean Of The Two Middle Samples */
+                sum += filter->sorted[middle - 1];
+                denominator *= 2;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+        else if(FILTER_MODE_TRIMMED == filter->mode)
+        {
+            /* The Trimmed Ends Are Taken Off The Sum Of The Window */
+            for(i=0; i<filter->trim; i++)
+            {
+                sum -= (uint32_t)filter->sorted[i] + filter->sorted[filter->count - 1 - i];
+            }
+            denominator = (uint32_t)divisor * (filter->count - 2 * filter->trim);
+        }
+        else
+        {
+            denominator = (uint32_t)divisor * filter->count;
+        }
+        *value = (uint16_t)((sum * scale + denominator / 2) / denominator);
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
@@ -41,7 +41,36 @@ extern Std_ReturnType Adc_Init(void);
  */
 extern Std_ReturnType Adc_GetValue(Adc_Value_t* value);
 /**
- * @brief Selects An Adc Channel
+ * @brief Starts a conversion of the selected channel and returns without waiting,
+ *        the ADC interrupt keeps the result for Adc_GetResult and calls the callback
+ * 
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if a conversion is still running
+ */
+extern Std_ReturnType Adc_StartConversion(void);
+/**
+ * @brief Gets the result of the last conversion started by Adc_StartConversion,
+ *        every result is given once
+ * 
+ * @param value the value that will be returned
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if there is no new result
+ */
+extern Std_ReturnType Adc_GetResult(Adc_Value_t* value);
+/**
+ * @brief Sets the callback that is called from the ADC interrupt when a conversion is complete,
+ *        the result is ready for Adc_GetResult when it is called
+ * 
+ * @param func the callback function, NULL for no callback
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Adc_SetCallBack(interruptCb_t func);
+/**
+ * @brief Selects An Adc Channel, Initializes Its Pin And Switches The Mux To It
  * 
  * @param channel The Channel To Be Selected
  *                  @arg ADC_CH_x
@@ -50,4 +79,34 @@ extern Std_ReturnType Adc_GetValue(Adc_Value_t* value);
  *                  E_NOT_OK : if the function is not executed correctly
  */
 extern Std_ReturnType Adc_SelectChannel(Adc_Channel_t channel);
+/**
+ * @brief Initializes The Pin Of An Adc Channel As An Input Without Switching The Mux
+ * 
+ * @param channel The Channel
+ *                  @arg ADC_CH_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Adc_InitChannel(Adc_Channel_t channel);
+/**
+ * @brief Switches The Mux To An Adc Channel Whose Pin Is Initialized, The Input Needs
+ *        The Acquisition Time Before The Next Conversion Starts
+ * 
+ * @param channel The Channel
+ *                  @arg ADC_CH_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Adc_SwitchChannel(Adc_Channel_t channel);
+
+/**
+ * @brief Tells if a conversion is running, SLEEP would stop it
+ * 
+ * @return Std_ReturnType A Status
+ *                  E_OK : if no conversion is running
+ *                  E_NOT_OK : if a conversion is running
+ */
+extern Std_ReturnType Adc_CheckIdle(void);
 #endif
\ No newline at end of file
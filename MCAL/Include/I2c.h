@@ -1,79 +1,119 @@
 /**
  * @file I2c.h
  * @author Mark Attia (markjosephattia@gmail.com)
- * @brief This is the user interface for the I2C Driver
+ * @brief This is the user interface for the I2C Driver, the transactions are queued and advanced
+ *        by the SSPIF interrupt one bus step at a time
  * @version 0.1
  * @date 2020-07-05
- * 
+ *
  * @copyright Copyright (c) 2020
- * 
+ *
  */
 #ifndef I2C_H_
 #define I2C_H_
 
-#define I2C_NO_ACK      0
-#define I2C_ACK         !I2C_NO_ACK
+/* The Status Of A Transaction */
+/* Never Submitted */
+#define I2C_STATUS_IDLE         0
+/* Waiting In The Queue */
+#define I2C_STATUS_PENDING      1
+/* On The Bus */
+#define I2C_STATUS_BUSY         2
+/* All The Bytes Were Transferred */
+#define I2C_STATUS_DONE         3
+/* The Slave Did Not Acknowledge Its Address Or A Written Byte */
+#define I2C_STATUS_NACK         4
+/* A Step Did Not Complete In Time, The Bus Was Recovered */
+#define I2C_STATUS_TIMEOUT      5
+/* A Step Did Not Complete In Time And A Slave Still Holds SDA Low After The Recovery Clocks, No Stop Was Sent */
+#define I2C_STATUS_BUS_LOCKED   6
+
+typedef struct i2cTransaction i2cTransaction_t;
+
+/* Called From The Interrupt When A Transaction Completes, The Status Tells How */
+typedef void (*i2cCallBack_t)(i2cTransaction_t* transaction);
+
+/* A Transaction Writes writeLength Bytes Then Reads readLength Bytes After A Repeated Start,
+ * Either Of Them May Be 0 */
+struct i2cTransaction
+{
+    /* The Slave Address Shifted Left, The Read Bit Is Set By The Driver */
+    uint8_t address;
+    const uint8_t* writeData;
+    uint8_t writeLength;
+    uint8_t* readData;
+    uint8_t readLength;
+    /* NULL For No Call Back */
+    i2cCallBack_t callBack;
+    volatile uint8_t status;
+};
+
+/* The Errors Of The Bus Since The Initialization, The Counts Stop At Their Maximum */
+typedef struct
+{
+    /* Including The Ones Of The EEPROM Acknowledge Polling */
+    uint16_t nacks;
+    uint16_t timeouts;
+    uint16_t recoveries;
+    /* The Recoveries That Left SDA Held Low */
+    uint16_t lockedBus;
+} i2cErrors_t;
 
 /**
  * @brief I2C Initialization
- * 
+ *
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
  *                  E_NOT_OK : if the function is not executed correctly
  */
 extern Std_ReturnType I2C_Master_Init(void);
 /**
- * @brief I2C Start of frame
- * 
- * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
- */
-extern Std_ReturnType I2c_Start(void);
-/**
- * @brief I2C Stop of frame
- * 
+ * @brief Queues a transaction, it starts right away if the bus is free and completes in the interrupt
+ *        The transaction and its buffers have to stay valid until it completes
+ *
+ * @param transaction The transaction
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the transaction is queued
+ *                  E_NOT_OK : if the queue is full, a length is set without its buffer or the transaction is already queued
  */
-extern Std_ReturnType I2c_Stop(void);
+extern Std_ReturnType I2c_Submit(i2cTransaction_t* transaction);
 /**
- * @brief I2C Send Ack
- * 
+ * @brief Queues a transaction and waits for it with the interrupt masked, for the boot time code
+ *        The transactions ahead of it in the queue are completed first, a step that does not complete
+ *        within I2C_TIMEOUT_POLLS polls of the flag is aborted and the bus is recovered
+ *
+ * @param transaction The transaction
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the transaction is done
+ *                  E_NOT_OK : if it could not be queued, the slave did not acknowledge or a step timed out
  */
-extern Std_ReturnType I2c_ACK(void);
+extern Std_ReturnType I2c_Transfer(i2cTransaction_t* transaction);
+
 /**
- * @brief I2C Send No Ack
- * 
+ * @brief Aborts the transaction on the bus if none of its steps completed since the previous call,
+ *        to be called periodically with a period longer than a byte on the bus
+ *
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the bus is idle or moved on
+ *                  E_NOT_OK : if a transaction was aborted
  */
-extern Std_ReturnType I2c_NACK(void);
+extern Std_ReturnType I2c_CheckTimeout(void);
 /**
- * @brief I2C Reads A Byte of Data
- * 
- * @param data The data to be stored
+ * @brief Gets the error counts of the bus
+ *
+ * @param errors The error counts
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
  *                  E_NOT_OK : if the function is not executed correctly
  */
-extern Std_ReturnType I2c_Read(uint8_t* data);
+extern Std_ReturnType I2c_GetErrors(i2cErrors_t* errors);
 /**
- * @brief I2C Writes A Byte
- * 
- * @param ack The Ack Returned
- *            @arg I2C_ACK
- *            @arg I2C_NO_ACK
- * @param data The Data to Be Written
+ * @brief Tells if a transaction is on the bus, SLEEP would stop the MSSP in the middle of it
+ *
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the bus is idle
+ *                  E_NOT_OK : if a transaction is running
  */
-extern Std_ReturnType I2c_Write(uint8_t* ack, uint8_t data);
+extern Std_ReturnType I2c_CheckIdle(void);
 
-#endif
\ No newline at end of file
+#endif
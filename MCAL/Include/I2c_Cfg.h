@@ -14,5 +14,11 @@
 #define I2C_BaudRate 100000
 #define I2C_CLK_FREQ 8000000
 
+/* The Transactions That Can Wait For The Bus, A Power Of 2 */
+#define I2C_QUEUE_SIZE 4
+
+/* The Polls Of The Flag Before A Step Times Out, About 1 ms While A Byte Takes 90 us */
+#define I2C_TIMEOUT_POLLS 200
+
 
 #endif
\ No newline at end of file
@@ -10,9 +10,30 @@
  */
 #ifndef INTERRUPT_H_
 #define INTERRUPT_H_
+#include "Hw.h"
 
 typedef void (*interruptCb_t)(void);
 
-extern interruptCb_t Timer1_func;
+extern HW_INSTANCE interruptCb_t Timer1_func;
+extern HW_INSTANCE interruptCb_t Adc_func;
+extern HW_INSTANCE interruptCb_t I2c_func;
+
+/**
+ * @brief Enables the global interrupt
+ * 
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Int_EnableGlobal(void);
+
+/**
+ * @brief Disables the global interrupt, the pending interrupts are taken when it is enabled again
+ * 
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Int_DisableGlobal(void);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,65 @@
+/**
+ * @file Wdt.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This file is the user interface for the watchdog timer driver, the watchdog is enabled by WDTE in Cfg.h
+ * @version 0.1
+ * @date 2020-07-15
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef WDT_H
+#define WDT_H
+
+/* The Prescalers, The Nominal Period Is 18 Milli Seconds Times The Prescaler (7 To 33 Milli Seconds Times The Prescaler) */
+#define WDT_DIV_1                   0b000
+#define WDT_DIV_2                   0b001
+#define WDT_DIV_4                   0b010
+#define WDT_DIV_8                   0b011
+#define WDT_DIV_16                  0b100
+#define WDT_DIV_32                  0b101
+#define WDT_DIV_64                  0b110
+#define WDT_DIV_128                 0b111
+
+/* The Reset Causes */
+#define WDT_RESET_POWER_ON          0
+#define WDT_RESET_BROWN_OUT         1
+#define WDT_RESET_WATCHDOG          2
+/* The MCLR Pin */
+#define WDT_RESET_EXTERNAL          3
+
+typedef uint8_t Wdt_Prescaler_t;
+typedef uint8_t Wdt_ResetCause_t;
+
+/**
+ * @brief Assigns the prescaler to the watchdog, Timer 0 runs without a prescaler after it
+ * 
+ * @param prescaler The prescaler
+ *                  @arg WDT_DIV_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Wdt_Init(Wdt_Prescaler_t prescaler);
+
+/**
+ * @brief Clears the watchdog timer
+ * 
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Wdt_Clear(void);
+
+/**
+ * @brief Gets the cause of the last reset from STATUS and PCON, then arms PCON for the next reset,
+ *        it must be called once at boot before the watchdog is cleared
+ * 
+ * @param cause The reset cause
+ *                  @arg WDT_RESET_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Wdt_GetResetCause(Wdt_ResetCause_t* cause);
+#endif
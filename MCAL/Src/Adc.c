@@ -10,22 +10,53 @@
  */
 #include "Std_Types.h"
 #include "Gpio.h"
+#include "Int.h"
 #include "Adc.h"
+#include "Hw.h"
 
 /* The ADC Registers */
-#define ADC_CON0_REG            *(uint8_t*)0x1F
-#define ADC_CON1_REG            *(uint8_t*)0x9F
-#define ADC_DATA_H              *(uint8_t*)0x1E
-#define ADC_DATA_L              *(uint8_t*)0x9E
+#define ADC_CON0_REG            0x1F
+#define ADC_CON1_REG            0x9F
+#define ADC_DATA_H              0x1E
+#define ADC_DATA_L              0x9E
+/* The Interrupt Registers */
+#define ADC_INT_CON             0x0B
+#define ADC_PIE                 0x8C
+#define ADC_PIF                 0x0C
 /* The ADC Masks */
 #define ADC_CONV_DONE            0x04
 #define ADC_CONV_START           0x04
 #define ADC_CH_CLR              0xC7
+#define ADC_INT_EN              0x40
+#define ADC_INT_FLAG_CLR        0xBF
+#define ADC_PERIPHERAL_INT_EN   0x40
 /* The ADC Initial Configurations */
 #define ADC_INIT_CONF_CON0      0x01
 #define ADC_INIT_CONF_CON1      0x80
 
+/* The Result Of The Last Conversion And If It Was Not Taken Yet */
+static HW_INSTANCE volatile Adc_Value_t Adc_result;
+static HW_INSTANCE volatile uint8_t Adc_ready;
+/* The User Callback Of A Complete Conversion */
+static HW_INSTANCE interruptCb_t Adc_callBack;
 
+/**
+ * @brief Keeps the result of a complete conversion, it runs in the ADC interrupt
+ * 
+ */
+static void Adc_ConversionDone(void)
+{
+    Adc_result = ((Adc_Value_t)HW_READ8(ADC_DATA_H) << 8) | HW_READ8(ADC_DATA_L);
+    Adc_ready = 1;
+    if(Adc_callBack)
+    {
+        Adc_callBack();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
 
 /**
  * @brief The ADC port and configurations initialization
@@ -37,8 +68,14 @@
 Std_ReturnType Adc_Init(void)
 {
     /* Setting ADC Configuration Registers With Their Initial Values */
-    ADC_CON0_REG = ADC_INIT_CONF_CON0;
-    ADC_CON1_REG = ADC_INIT_CONF_CON1;
+    HW_WRITE8(ADC_CON0_REG, ADC_INIT_CONF_CON0);
+    HW_WRITE8(ADC_CON1_REG, ADC_INIT_CONF_CON1);
+    /* Enable The Conversion Complete Interrupt, The Global Enable Is Left To The Scheduler */
+    Adc_ready = 0;
+    Adc_func = Adc_ConversionDone;
+    HW_AND8(ADC_PIF, ADC_INT_FLAG_CLR);
+    HW_OR8(ADC_PIE, ADC_INT_EN);
+    HW_OR8(ADC_INT_CON, ADC_PERIPHERAL_INT_EN);
     return E_OK;
 }
 
@@ -53,16 +90,81 @@ Std_ReturnType Adc_Init(void)
 Std_ReturnType Adc_GetValue(Adc_Value_t* value)
 {
     /* Start The Conversion */
-    ADC_CON0_REG |= ADC_CONV_START;
+    HW_OR8(ADC_CON0_REG, ADC_CONV_START);
     /* Wait For The Conversion */
-    while(ADC_CON0_REG & ADC_CONV_DONE);
+    while(HW_READ8(ADC_CON0_REG) & ADC_CONV_DONE);
     /* Save The Data */
-    *value = (ADC_DATA_H << 8) | ADC_DATA_L;
+    *value = ((Adc_Value_t)HW_READ8(ADC_DATA_H) << 8) | HW_READ8(ADC_DATA_L);
     return E_OK;
 }
 
 /**
- * @brief Selects An Adc Channel
+ * @brief Starts a conversion of the selected channel and returns without waiting,
+ *        the ADC interrupt keeps the result for Adc_GetResult and calls the callback
+ * 
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if a conversion is still running
+ */
+Std_ReturnType Adc_StartConversion(void)
+{
+    Std_ReturnType error = E_OK;
+    if(HW_READ8(ADC_CON0_REG) & ADC_CONV_DONE)
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        /* The Old Result Is Dropped */
+        Adc_ready = 0;
+        HW_OR8(ADC_CON0_REG, ADC_CONV_START);
+    }
+    return error;
+}
+
+/**
+ * @brief Gets the result of the last conversion started by Adc_StartConversion,
+ *        every result is given once
+ * 
+ * @param value the value that will be returned
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if there is no new result
+ */
+Std_ReturnType Adc_GetResult(Adc_Value_t* value)
+{
+    Std_ReturnType error = E_NOT_OK;
+    /* The Interrupt Does Not Write The Result Again Before The Next Start */
+    if(Adc_ready)
+    {
+        *value = Adc_result;
+        Adc_ready = 0;
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Sets the callback that is called from the ADC interrupt when a conversion is complete,
+ *        the result is ready for Adc_GetResult when it is called
+ * 
+ * @param func the callback function, NULL for no callback
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Adc_SetCallBack(interruptCb_t func)
+{
+    Adc_callBack = func;
+    return E_OK;
+}
+
+/**
+ * @brief Selects An Adc Channel, Initializes Its Pin And Switches The Mux To It
  * 
  * @param channel The Channel To Be Selected
  *                  @arg ADC_CH_x
@@ -71,6 +173,21 @@ Std_ReturnType Adc_GetValue(Adc_Value_t* value)
  *                  E_NOT_OK : if the function is not executed correctly
  */
 Std_ReturnType Adc_SelectChannel(Adc_Channel_t channel)
+{
+    Adc_InitChannel(channel);
+    return Adc_SwitchChannel(channel);
+}
+
+/**
+ * @brief Initializes The Pin Of An Adc Channel As An Input Without Switching The Mux
+ * 
+ * @param channel The Channel
+ *                  @arg ADC_CH_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Adc_InitChannel(Adc_Channel_t channel)
 {
     /* Initialize GPIO Pins For The Required Channel */
     gpio_t gpio = {
@@ -109,8 +226,34 @@ Std_ReturnType Adc_SelectChannel(Adc_Channel_t channel)
             break;
     }
     Gpio_InitPins(&gpio);
-    /* Select The ADC Channel */
-    ADC_CON0_REG &= ADC_CH_CLR;
-    ADC_CON0_REG |= channel;
     return E_OK;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Switches The Mux To An Adc Channel Whose Pin Is Initialized, The Input Needs
+ *        The Acquisition Time Before The Next Conversion Starts
+ * 
+ * @param channel The Channel
+ *                  @arg ADC_CH_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Adc_SwitchChannel(Adc_Channel_t channel)
+{
+    /* Select The ADC Channel In One Write So The Mux Does Not Pass Through Channel 0 */
+    HW_WRITE8(ADC_CON0_REG, (HW_READ8(ADC_CON0_REG) & ADC_CH_CLR) | channel);
+    return E_OK;
+}
+
+/**
+ * @brief Tells if a conversion is running, SLEEP would stop it
+ * 
+ * @return Std_ReturnType A Status
+ *                  E_OK : if no conversion is running
+ *                  E_NOT_OK : if a conversion is running
+ */
+Std_ReturnType Adc_CheckIdle(void)
+{
+    return (HW_READ8(ADC_CON0_REG) & ADC_CONV_DONE) ? E_NOT_OK : E_OK;
+}
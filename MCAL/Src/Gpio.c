@@ -8,6 +8,7 @@
  */
 #include "Std_Types.h"
 #include "Gpio.h"
+#include "Hw.h"
 
 /* GPIO TRIS Base Address */
 #define     GPIO_TRIS                                0x80
@@ -36,12 +37,12 @@ extern Std_ReturnType Gpio_InitPins(gpio_t* gpio)
     {
         case GPIO_MODE_OUTPUT_PP:
             /* Set The Pins As Output */
-            *(uint8_t*)(gpio->port + GPIO_TRIS) &= ~(gpio->pins);
+            HW_AND8(gpio->port + GPIO_TRIS, ~(gpio->pins));
             err = E_OK;
             break;
         case GPIO_MODE_INPUT:
             /* Set The Pins As Input */
-            *(uint8_t*)(gpio->port + GPIO_TRIS) |= gpio->pins;
+            HW_OR8(gpio->port + GPIO_TRIS, gpio->pins);
             err = E_OK;
             break;
     }
@@ -76,12 +77,12 @@ extern Std_ReturnType Gpio_WritePin(Gpio_Port_t port, Gpio_Pins_t pin, Gpio_PinS
     {
         /* Set The Pins As High */
         case GPIO_PIN_SET:
-            *(uint8_t*)(port) |= pin;
+            HW_OR8(port, pin);
             errorRet = E_OK;
             break;
         /* Set The Pins As Low */
         case GPIO_PIN_RESET:
-            *(uint8_t*)(port) &= ~pin;
+            HW_AND8(port, ~pin);
             errorRet = E_OK;
             break;
     }
@@ -110,7 +111,7 @@ extern Std_ReturnType Gpio_WritePin(Gpio_Port_t port, Gpio_Pins_t pin, Gpio_PinS
 extern Std_ReturnType Gpio_ReadPin(Gpio_Port_t port, Gpio_Pins_t pin, Gpio_PinStatus_t* state)
 {
     /* Get The Pin Status */
-    *state = !(*(uint8_t*)(port) & pin);
+    *state = !(HW_READ8(port) & pin);
     return E_OK;
 }
 
@@ -130,7 +131,7 @@ extern Std_ReturnType Gpio_ReadPin(Gpio_Port_t port, Gpio_Pins_t pin, Gpio_PinSt
 extern Std_ReturnType Gpio_SetPortBPullup(Gpio_PullupStatus_t pullupState)
 {
     /* Sets PortB Pullup Status */
-    *(uint8_t*)GPIO_OPTION_REG |= GPIO_PORTB_PULLUP_CLR;
-    *(uint8_t*)GPIO_OPTION_REG &= pullupState;
+    HW_OR8(GPIO_OPTION_REG, GPIO_PORTB_PULLUP_CLR);
+    HW_AND8(GPIO_OPTION_REG, pullupState);
     return E_OK;
 }
\ No newline at end of file
@@ -1,47 +1,361 @@
 /**
  * @file I2c.c
  * @author Mark Attia (markjosephattia@gmail.com)
- * @brief This is the implementation for the I2C Driver
+ * @brief This is the implementation for the I2C Driver, every SSPIF ends a start, an address, a data byte,
+ *        an acknowledge or a stop and the interrupt starts the next step of the transaction on the bus
+ *        A step that never ends aborts the transaction and the bus is recovered by clocking out the slave
+ *        with the lines driven like open drain outputs
  * @version 0.1
  * @date 2020-07-05
- * 
+ *
  * @copyright Copyright (c) 2020
- * 
+ *
  */
 #include "Std_Types.h"
 #include "I2c.h"
 #include "I2c_Cfg.h"
 #include "Gpio.h"
+#include "Int.h"
+#include "Hw.h"
 /* I2C Registers */
-#define I2C_SSPBUF              *(uint8_t*)0x13
-#define I2C_SSPCON              *(uint8_t*)0x14
-#define I2C_SSPCON2             *(uint8_t*)0x91
-#define I2C_SSPADD              *(uint8_t*)0x93
-#define I2C_SSPSTAT             *(uint8_t*)0x94
+#define I2C_SSPBUF              0x13
+#define I2C_SSPCON              0x14
+#define I2C_SSPCON2             0x91
+#define I2C_SSPADD              0x93
+#define I2C_SSPSTAT             0x94
 /* Interrupt Registers */
-#define INTERRUPT_PIR1          *(uint8_t*)0x0C
+#define INTERRUPT_INTCON        0x0B
+#define INTERRUPT_PIR1          0x0C
+#define INTERRUPT_PIE1          0x8C
 /* Interrupt Masks */
 #define INTERRUPT_SSPIF         0x08
 #define INTERRUPT_SSPIF_CLR     0xF7
+#define INTERRUPT_SSPIE         0x08
+#define INTERRUPT_SSPIE_CLR     0xF7
+#define INTERRUPT_PEIE          0x40
 /* I2C Configurations Initial States */
 #define I2C_SSPCON_CONF         0x28
 #define I2C_SSPCON2_CONF        0x00
 #define I2C_SSPSTAT_CONF        0x00
 /* I2C Masks */
-#define I2C_READABLE    0x04
+#define I2C_SSPEN_CLR   0xDF
 #define I2C_SEN         0x01
+#define I2C_RSEN        0x02
 #define I2C_PEN         0x04
 #define I2C_RCEN        0x08
-#define I2C_SSPCON2_EN  0x1F
 #define I2C_ACK_EN      0x10
+#define I2C_ACK_DT      0x20
+#define I2C_ACK_DT_CLR  0xDF
 #define I2C_ACK_STAT    0x40
-#define I2C_ACK_DT_CLR  0xEF
-#define I2C_ACK_DT      0x00
-#define I2C_NO_ACK_DT   0x10
+/* The Read Bit Of The Address */
+#define I2C_READ        0x01
+/* The Pins Of The Bus */
+#define I2C_SCL         GPIO_PIN_3
+#define I2C_SDA         GPIO_PIN_4
+/* A Slave Holding SDA Low Releases It Within A Byte And Its Acknowledge */
+#define I2C_RECOVERY_PULSES     9
+/* The Largest Error Count */
+#define I2C_ERRORS_MAX          0xFFFF
+
+/* The Steps Of A Transaction, Each One Waits For The SSPIF Of The Operation Started Before It */
+#define I2C_STEP_IDLE           0
+#define I2C_STEP_START          1
+#define I2C_STEP_WRITE          2
+#define I2C_STEP_RESTART        3
+#define I2C_STEP_READ_ADDRESS   4
+#define I2C_STEP_READ           5
+#define I2C_STEP_ACK            6
+#define I2C_STEP_STOP           7
+
+#define I2C_QUEUE_MASK          (I2C_QUEUE_SIZE - 1)
+
+STD_STATIC_ASSERT((I2C_QUEUE_SIZE & I2C_QUEUE_MASK) == 0, I2c_queueSizeCheck);
+
+/* The Queued Transactions, The One At The Head Is On The Bus */
+static HW_INSTANCE i2cTransaction_t* volatile I2c_queue[I2C_QUEUE_SIZE];
+static HW_INSTANCE volatile uint8_t I2c_head;
+static HW_INSTANCE volatile uint8_t I2c_count;
+/* The Step Of The Transaction At The Head */
+static HW_INSTANCE volatile uint8_t I2c_step;
+/* The Next Byte To Write Or To Read */
+static HW_INSTANCE volatile uint8_t I2c_index;
+/* The Status The Transaction Gets After The Stop */
+static HW_INSTANCE volatile uint8_t I2c_result;
+/* A Step Completed Since The Last Timeout Check */
+static HW_INSTANCE volatile uint8_t I2c_progress;
+static HW_INSTANCE i2cErrors_t I2c_errors;
+
+/**
+ * @brief Counts an error up to the maximum
+ *
+ * @param count The count
+ */
+static void I2c_CountError(uint16_t* count)
+{
+  if(*count < I2C_ERRORS_MAX)
+  {
+    (*count)++;
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+}
+
+/**
+ * @brief Drives a line of the bus like an open drain output, the latch of the pin is kept low so the line is
+ *        pulled low as an output and released as an input, the pull up takes it high unless a slave holds it
+ *
+ * @param pin The pin of the line
+ * @param level GPIO_PIN_RESET pulls the line low, GPIO_PIN_SET releases it
+ */
+static void I2c_DriveLine(Gpio_Pins_t pin, Gpio_PinStatus_t level)
+{
+  gpio_t line = {.pins= pin, .mode= GPIO_MODE_INPUT, .port= GPIO_PORTC};
+  if(GPIO_PIN_SET != level)
+  {
+    /* A Read-Modify-Write Of PORTC May Have Copied The High Level Of The Released Line To Its Latch */
+    Gpio_WritePin(GPIO_PORTC, pin, GPIO_PIN_RESET);
+    line.mode = GPIO_MODE_OUTPUT_PP;
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+  Gpio_InitPins(&line);
+}
+
+/**
+ * @brief Takes the pins from the MSSP, clocks SCL until the slave releases SDA, sends a stop
+ *        and gives the pins back to a reset MSSP, the pins are fast enough without delays
+ *        The lines are only ever pulled low or released, a slave that still holds SDA low gets no stop
+ *
+ * @return Std_ReturnType A Status
+ *                  E_OK : if SDA was released and the stop was sent
+ *                  E_NOT_OK : if the slave still holds SDA low after I2C_RECOVERY_PULSES clocks
+ */
+static Std_ReturnType I2c_Recover(void)
+{
+  Std_ReturnType error = E_OK;
+  Gpio_PinStatus_t level;
+  uint8_t pulses;
+  HW_AND8(I2C_SSPCON, I2C_SSPEN_CLR);
+  I2c_DriveLine(I2C_SCL, GPIO_PIN_SET);
+  I2c_DriveLine(I2C_SDA, GPIO_PIN_SET);
+  Gpio_ReadPin(GPIO_PORTC, I2C_SDA, &level);
+  for(pulses=0; pulses<I2C_RECOVERY_PULSES && GPIO_PIN_SET != level; pulses++)
+  {
+    I2c_DriveLine(I2C_SCL, GPIO_PIN_RESET);
+    I2c_DriveLine(I2C_SCL, GPIO_PIN_SET);
+    Gpio_ReadPin(GPIO_PORTC, I2C_SDA, &level);
+  }
+  if(GPIO_PIN_SET == level)
+  {
+    /* The Stop, SDA Is Released While SCL Is Released */
+    I2c_DriveLine(I2C_SCL, GPIO_PIN_RESET);
+    I2c_DriveLine(I2C_SDA, GPIO_PIN_RESET);
+    I2c_DriveLine(I2C_SCL, GPIO_PIN_SET);
+    I2c_DriveLine(I2C_SDA, GPIO_PIN_SET);
+    I2c_CountError(&I2c_errors.recoveries);
+  }
+  else
+  {
+    /* Both Lines Stay Released, The Next Timeout Tries Again */
+    I2c_CountError(&I2c_errors.lockedBus);
+    error = E_NOT_OK;
+  }
+  /* The MSSP Starts Again Without The Operation That Hung */
+  HW_WRITE8(I2C_SSPCON2, I2C_SSPCON2_CONF);
+  HW_WRITE8(I2C_SSPCON, I2C_SSPCON_CONF);
+  HW_AND8(INTERRUPT_PIR1, INTERRUPT_SSPIF_CLR);
+  return error;
+}
+
+/**
+ * @brief Starts the transaction at the head of the queue if there is one
+ *
+ */
+static void I2c_Begin(void)
+{
+  if(I2c_count)
+  {
+    I2c_queue[I2c_head]->status = I2C_STATUS_BUSY;
+    /* The Timeout Check Gives The New Transaction A Full Period */
+    I2c_progress = 1;
+    I2c_index = 0;
+    I2c_step = I2C_STEP_START;
+    HW_OR8(I2C_SSPCON2, I2C_SEN);
+  }
+  else
+  {
+    I2c_step = I2C_STEP_IDLE;
+  }
+}
+
+/**
+ * @brief Ends the transaction on the bus with a stop
+ *
+ * @param result The status of the transaction
+ */
+static void I2c_Stop(uint8_t result)
+{
+  I2c_result = result;
+  I2c_step = I2C_STEP_STOP;
+  HW_OR8(I2C_SSPCON2, I2C_PEN);
+}
+
+/**
+ * @brief Completes the transaction at the head after its stop and starts the next one
+ *
+ */
+static void I2c_Complete(void)
+{
+  i2cTransaction_t* transaction = I2c_queue[I2c_head];
+  if(I2C_STATUS_NACK == I2c_result)
+  {
+    I2c_CountError(&I2c_errors.nacks);
+  }
+  else if(I2C_STATUS_TIMEOUT == I2c_result || I2C_STATUS_BUS_LOCKED == I2c_result)
+  {
+    I2c_CountError(&I2c_errors.timeouts);
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+  /* The Queue Moves On Before The Call Back So It Can Submit Again */
+  I2c_head = (I2c_head + 1) & I2C_QUEUE_MASK;
+  I2c_count--;
+  transaction->status = I2c_result;
+  if(transaction->callBack)
+  {
+    transaction->callBack(transaction);
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+  /* A Call Back That Submitted To An Empty Queue Has Already Started The Bus */
+  if(I2C_STEP_STOP == I2c_step)
+  {
+    I2c_Begin();
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+}
+
+/**
+ * @brief Aborts the transaction at the head, recovers the bus and starts the next one
+ *        The interrupt has to be masked
+ *
+ */
+static void I2c_Abort(void)
+{
+  I2c_result = (I2c_Recover() == E_OK) ? I2C_STATUS_TIMEOUT : I2C_STATUS_BUS_LOCKED;
+  I2c_step = I2C_STEP_STOP;
+  I2c_Complete();
+}
+
+/**
+ * @brief Advances the transaction at the head by one step, called on every SSPIF
+ *
+ */
+static void I2c_Step(void)
+{
+  i2cTransaction_t* transaction = I2c_queue[I2c_head];
+  I2c_progress = 1;
+  switch(I2c_step)
+  {
+    case I2C_STEP_START:
+      /* A Transaction Without Bytes To Write Reads Right After The Start */
+      if(transaction->writeLength)
+      {
+        I2c_step = I2C_STEP_WRITE;
+        HW_WRITE8(I2C_SSPBUF, transaction->address);
+      }
+      else
+      {
+        I2c_step = I2C_STEP_READ_ADDRESS;
+        HW_WRITE8(I2C_SSPBUF, transaction->address | I2C_READ);
+      }
+      break;
+    case I2C_STEP_WRITE:
+      /* The Address Or The Last Byte Is Out */
+      if(HW_READ8(I2C_SSPCON2) & I2C_ACK_STAT)
+      {
+        I2c_Stop(I2C_STATUS_NACK);
+      }
+      else if(I2c_index < transaction->writeLength)
+      {
+        HW_WRITE8(I2C_SSPBUF, transaction->writeData[I2c_index]);
+        I2c_index++;
+      }
+      else if(transaction->readLength)
+      {
+        I2c_step = I2C_STEP_RESTART;
+        HW_OR8(I2C_SSPCON2, I2C_RSEN);
+      }
+      else
+      {
+        I2c_Stop(I2C_STATUS_DONE);
+      }
+      break;
+    case I2C_STEP_RESTART:
+      I2c_step = I2C_STEP_READ_ADDRESS;
+      HW_WRITE8(I2C_SSPBUF, transaction->address | I2C_READ);
+      break;
+    case I2C_STEP_READ_ADDRESS:
+      if(HW_READ8(I2C_SSPCON2) & I2C_ACK_STAT)
+      {
+        I2c_Stop(I2C_STATUS_NACK);
+      }
+      else
+      {
+        I2c_index = 0;
+        I2c_step = I2C_STEP_READ;
+        HW_OR8(I2C_SSPCON2, I2C_RCEN);
+      }
+      break;
+    case I2C_STEP_READ:
+      transaction->readData[I2c_index] = HW_READ8(I2C_SSPBUF);
+      I2c_index++;
+      /* The Last Byte Is Not Acknowledged So The Slave Releases The Bus */
+      if(I2c_index < transaction->readLength)
+      {
+        HW_AND8(I2C_SSPCON2, I2C_ACK_DT_CLR);
+      }
+      else
+      {
+        HW_OR8(I2C_SSPCON2, I2C_ACK_DT);
+      }
+      I2c_step = I2C_STEP_ACK;
+      HW_OR8(I2C_SSPCON2, I2C_ACK_EN);
+      break;
+    case I2C_STEP_ACK:
+      if(I2c_index < transaction->readLength)
+      {
+        I2c_step = I2C_STEP_READ;
+        HW_OR8(I2C_SSPCON2, I2C_RCEN);
+      }
+      else
+      {
+        I2c_Stop(I2C_STATUS_DONE);
+      }
+      break;
+    case I2C_STEP_STOP:
+      I2c_Complete();
+      break;
+    default:
+      /* A Flag Without A Transaction */
+      break;
+  }
+}
 
 /**
  * @brief I2C Initialization
- * 
+ *
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
  *                  E_NOT_OK : if the function is not executed correctly
@@ -54,125 +368,173 @@ Std_ReturnType I2C_Master_Init(void)
         .mode= GPIO_MODE_OUTPUT_PP,
         .port= GPIO_PORTC};
   /* Set The Initial Configurations */
-  I2C_SSPCON = I2C_SSPCON_CONF;
-  I2C_SSPCON2 = I2C_SSPCON2_CONF;
-  I2C_SSPSTAT = I2C_SSPSTAT_CONF;
+  HW_WRITE8(I2C_SSPCON, I2C_SSPCON_CONF);
+  HW_WRITE8(I2C_SSPCON2, I2C_SSPCON2_CONF);
+  HW_WRITE8(I2C_SSPSTAT, I2C_SSPSTAT_CONF);
   /* Set The Baudrate*/
-  I2C_SSPADD = ((I2C_CLK_FREQ/4)/I2C_BaudRate) - 1;
+  HW_WRITE8(I2C_SSPADD, ((I2C_CLK_FREQ/4)/I2C_BaudRate) - 1);
   Gpio_InitPins(&gpio);
+  I2c_head = 0;
+  I2c_count = 0;
+  I2c_step = I2C_STEP_IDLE;
+  I2c_progress = 0;
+  I2c_errors.nacks = 0;
+  I2c_errors.timeouts = 0;
+  I2c_errors.recoveries = 0;
+  I2c_errors.lockedBus = 0;
+  /* Enable The SSP Interrupt, The Global Enable Is Left To The Scheduler */
+  I2c_func = I2c_Step;
+  HW_AND8(INTERRUPT_PIR1, INTERRUPT_SSPIF_CLR);
+  HW_OR8(INTERRUPT_PIE1, INTERRUPT_SSPIE);
+  HW_OR8(INTERRUPT_INTCON, INTERRUPT_PEIE);
   return E_OK;
 }
+
 /**
- * @brief I2C Start of frame
- * 
+ * @brief Queues a transaction, it starts right away if the bus is free and completes in the interrupt
+ *        The transaction and its buffers have to stay valid until it completes
+ *
+ * @param transaction The transaction
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the transaction is queued
+ *                  E_NOT_OK : if the queue is full, a length is set without its buffer or the transaction is already queued
  */
-Std_ReturnType I2c_Start(void)
+Std_ReturnType I2c_Submit(i2cTransaction_t* transaction)
 {
-  /* Wait For The Bus To Be Ready */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  /* Send The Start Bit */
-  I2C_SSPCON2 |= I2C_SEN;
-  return E_OK;
+  Std_ReturnType error = E_NOT_OK;
+  /* The Interrupt Also Takes Transactions Off The Queue */
+  uint8_t enabled = HW_READ8(INTERRUPT_PIE1) & INTERRUPT_SSPIE;
+  if((0 == transaction->writeLength || NULL != transaction->writeData) && (0 == transaction->readLength || NULL != transaction->readData))
+  {
+    HW_AND8(INTERRUPT_PIE1, INTERRUPT_SSPIE_CLR);
+    if(I2c_count < I2C_QUEUE_SIZE && I2C_STATUS_PENDING != transaction->status && I2C_STATUS_BUSY != transaction->status)
+    {
+      transaction->status = I2C_STATUS_PENDING;
+      I2c_queue[(I2c_head + I2c_count) & I2C_QUEUE_MASK] = transaction;
+      I2c_count++;
+      /* The Bus Is Free Between The Stop Of The Last Transaction And The Start Of The Next One */
+      if(I2C_STEP_IDLE == I2c_step || (I2C_STEP_STOP == I2c_step && 1 == I2c_count))
+      {
+        I2c_Begin();
+      }
+      else
+      {
+        /* Empty Else To Satisfy The Misra Rules */
+      }
+      error = E_OK;
+    }
+    else
+    {
+      /* Empty Else To Satisfy The Misra Rules */
+    }
+    HW_OR8(INTERRUPT_PIE1, enabled);
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+  return error;
 }
+
 /**
- * @brief I2C Stop of frame
- * 
+ * @brief Queues a transaction and waits for it with the interrupt masked, for the boot time code
+ *        The transactions ahead of it in the queue are completed first
+ *
+ * @param transaction The transaction
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the transaction is done
+ *                  E_NOT_OK : if it could not be queued or the slave did not acknowledge
  */
-Std_ReturnType I2c_Stop(void)
+Std_ReturnType I2c_Transfer(i2cTransaction_t* transaction)
 {
-  /* Wait For The Bus To Be Ready */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  /* Send The Stop Bit */
-  I2C_SSPCON2 |= I2C_PEN;
-  return E_OK;
+  Std_ReturnType error = I2c_Submit(transaction);
+  uint8_t enabled = HW_READ8(INTERRUPT_PIE1) & INTERRUPT_SSPIE;
+  uint16_t polls = 0;
+  if(E_OK == error)
+  {
+    /* The Steps Run Here Until The Transaction Completes, Each One Within The Polls */
+    HW_AND8(INTERRUPT_PIE1, INTERRUPT_SSPIE_CLR);
+    while(I2C_STATUS_PENDING == transaction->status || I2C_STATUS_BUSY == transaction->status)
+    {
+      if(HW_READ8(INTERRUPT_PIR1) & INTERRUPT_SSPIF)
+      {
+        HW_AND8(INTERRUPT_PIR1, INTERRUPT_SSPIF_CLR);
+        I2c_Step();
+        polls = 0;
+      }
+      else if(polls < I2C_TIMEOUT_POLLS)
+      {
+        polls++;
+      }
+      else
+      {
+        I2c_Abort();
+        polls = 0;
+      }
+    }
+    HW_OR8(INTERRUPT_PIE1, enabled);
+    error = (I2C_STATUS_DONE == transaction->status) ? E_OK : E_NOT_OK;
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+  return error;
 }
+
 /**
- * @brief I2C Send Ack
- * 
+ * @brief Aborts the transaction on the bus if none of its steps completed since the previous call,
+ *        to be called periodically with a period longer than a byte on the bus
+ *
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the bus is idle or moved on
+ *                  E_NOT_OK : if a transaction was aborted
  */
-Std_ReturnType I2c_ACK(void)
+Std_ReturnType I2c_CheckTimeout(void)
 {
-  /* Wait For The Bus To Be Ready */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  /* Clears The Ack Bit */
-  I2C_SSPCON2 &= I2C_ACK_DT_CLR;
-  /* Sets The Ack */
-  I2C_SSPCON2 |= I2C_ACK_DT;
-  /* Trigger The Ack Transmission */
-  I2C_SSPCON2 |= I2C_ACK_EN;
-  return E_OK;
+  Std_ReturnType error = E_OK;
+  uint8_t enabled = HW_READ8(INTERRUPT_PIE1) & INTERRUPT_SSPIE;
+  HW_AND8(INTERRUPT_PIE1, INTERRUPT_SSPIE_CLR);
+  /* A Raised Flag Is A Completed Step The Interrupt Did Not Take Yet */
+  if(I2C_STEP_IDLE != I2c_step && 0 == I2c_progress && 0 == (HW_READ8(INTERRUPT_PIR1) & INTERRUPT_SSPIF))
+  {
+    I2c_Abort();
+    error = E_NOT_OK;
+  }
+  else
+  {
+    /* Empty Else To Satisfy The Misra Rules */
+  }
+  I2c_progress = 0;
+  HW_OR8(INTERRUPT_PIE1, enabled);
+  return error;
 }
+
 /**
- * @brief I2C Send No Ack
- * 
+ * @brief Gets the error counts of the bus
+ *
+ * @param errors The error counts
  * @return Std_ReturnType A Status
  *                  E_OK : if the function is executed correctly
  *                  E_NOT_OK : if the function is not executed correctly
  */
-Std_ReturnType I2c_NACK(void)
+Std_ReturnType I2c_GetErrors(i2cErrors_t* errors)
 {
-  /* Wait For The Bus To Be Ready */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  /* Clears The Ack Bit */
-  I2C_SSPCON2 &= I2C_ACK_DT_CLR;
-  /* Sets The No Ack */
-  I2C_SSPCON2 |= I2C_NO_ACK_DT;
-  /* Trigger The Ack Transmission */
-  I2C_SSPCON2 |= I2C_ACK_EN;
+  uint8_t enabled = HW_READ8(INTERRUPT_PIE1) & INTERRUPT_SSPIE;
+  HW_AND8(INTERRUPT_PIE1, INTERRUPT_SSPIE_CLR);
+  *errors = I2c_errors;
+  HW_OR8(INTERRUPT_PIE1, enabled);
   return E_OK;
 }
+
 /**
- * @brief I2C Reads A Byte of Data
- * 
- * @param data The data to be stored
+ * @brief Tells if a transaction is on the bus, SLEEP would stop the MSSP in the middle of it
+ *
  * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
+ *                  E_OK : if the bus is idle
+ *                  E_NOT_OK : if a transaction is running
  */
-Std_ReturnType I2c_Read(uint8_t* data)
+Std_ReturnType I2c_CheckIdle(void)
 {
-  /* Wait For The Bus To Be Ready */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  /* Read Bit Set */
-  I2C_SSPCON2 |= I2C_RCEN;
-  /* Wait For The Flag To Be Raised */
-  while(!(INTERRUPT_PIR1 & INTERRUPT_SSPIF));
-  /* Clears The Read Interrupt Flag */
-  INTERRUPT_PIR1 &= INTERRUPT_SSPIF_CLR;
-  /* Wait For The Read To Be Finished */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  /* Saves The Data */
-  *data = I2C_SSPBUF;
-  return E_OK;
+  return (I2C_STEP_IDLE == I2c_step) ? E_OK : E_NOT_OK;
 }
-/**
- * @brief I2C Writes A Byte
- * 
- * @param ack The Ack Returned
- *            @arg I2C_ACK
- *            @arg I2C_NO_ACK
- * @param data The Data to Be Written
- * @return Std_ReturnType A Status
- *                  E_OK : if the function is executed correctly
- *                  E_NOT_OK : if the function is not executed correctly
- */
-Std_ReturnType I2c_Write(uint8_t* ack, uint8_t data)
-{
-  /* Wait For The Bus To Be Ready */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  I2C_SSPBUF = data;
-  /* Wait For The Write To Be Done */
-  while ((I2C_SSPSTAT & I2C_READABLE) | (I2C_SSPCON2 & I2C_SSPCON2_EN));
-  /* Saves The Ack */
-  *ack = !(I2C_SSPCON2 & I2C_ACK_STAT);
-  return E_OK;
-}
\ No newline at end of file
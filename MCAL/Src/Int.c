@@ -10,24 +10,40 @@
  */
 #include "Std_Types.h"
 #include "Int.h"
+#include "Hw.h"
 
 /* The Prihperal Interrupt Flags Register */
-#define PIF                       *(uint8_t*)0x0C
+#define PIF                       0x0C
+/* The Prihperal Interrupt Enables Register */
+#define PIE                       0x8C
+/* The Interrupt Control Register */
+#define INT_CON                   0x0B
 /* Masks */
 #define CCP1_INT_FLAG                        0x04
 #define CCP1_INT_FLAG_CLR                    0xFB
+#define ADC_INT_FLAG                         0x40
+#define ADC_INT_FLAG_CLR                     0xBF
+#define SSP_INT_FLAG                         0x08
+#define SSP_INT_FLAG_CLR                     0xF7
+#define SSP_INT_EN                           0x08
+#define GLOBAL_INT_EN                        0x80
+#define GLOBAL_INT_DIS                       0x7F
 
 /* Timer 1 Callback Function */
-interruptCb_t Timer1_func = NULL;
+HW_INSTANCE interruptCb_t Timer1_func = NULL;
+/* ADC Conversion Complete Callback Function */
+HW_INSTANCE interruptCb_t Adc_func = NULL;
+/* I2C Step Complete Callback Function */
+HW_INSTANCE interruptCb_t I2c_func = NULL;
 
 /**
  * @brief Global Interrupt Service Routine
  * 
  */
-void __interrupt() ISR()
+void HW_INTERRUPT ISR(void)
 {
     /* Check For CCP1 Interrupt */
-    if(PIF & CCP1_INT_FLAG)
+    if(HW_READ8(PIF) & CCP1_INT_FLAG)
 	{
         if(Timer1_func)
         {
@@ -38,11 +54,73 @@ void __interrupt() ISR()
             /* Empty Else To Satisfy The Misra Rules */
         }
         /* Clear The Flag */
-        PIF &= CCP1_INT_FLAG_CLR;
+        HW_AND8(PIF, CCP1_INT_FLAG_CLR);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    /* Check For ADC Interrupt */
+    if(HW_READ8(PIF) & ADC_INT_FLAG)
+    {
+        /* Clear The Flag First, The Callback May Start The Next Conversion */
+        HW_AND8(PIF, ADC_INT_FLAG_CLR);
+        if(Adc_func)
+        {
+            Adc_func();
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    /* Check For I2C Interrupt, The Driver Masks It While It Polls The Flag Itself */
+    if((HW_READ8(PIF) & SSP_INT_FLAG) && (HW_READ8(PIE) & SSP_INT_EN))
+    {
+        /* Clear The Flag First, The Callback Starts The Next Step */
+        HW_AND8(PIF, SSP_INT_FLAG_CLR);
+        if(I2c_func)
+        {
+            I2c_func();
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
     }
     else
     {
         /* Empty Else To Satisfy The Misra Rules */
     }
     
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Enables the global interrupt
+ * 
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Int_EnableGlobal(void)
+{
+    HW_OR8(INT_CON, GLOBAL_INT_EN);
+    return E_OK;
+}
+
+/**
+ * @brief Disables the global interrupt, the pending interrupts are taken when it is enabled again
+ * 
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Int_DisableGlobal(void)
+{
+    HW_AND8(INT_CON, GLOBAL_INT_DIS);
+    return E_OK;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file Wdt.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief This is the implementation for the watchdog timer driver
+ * @version 0.1
+ * @date 2020-07-15
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#include "Std_Types.h"
+#include "Wdt.h"
+#include "Hw.h"
+
+/* Registers */
+#define WDT_STATUS                  0x03
+#define WDT_OPTION_REG              0x81
+#define WDT_PCON                    0x8E
+
+/* Masks */
+#define WDT_TO                      0x10
+#define WDT_POR                     0x02
+#define WDT_BOR                     0x01
+#define WDT_PSA                     0x08
+#define WDT_PS_CLR                  0xF8
+
+/**
+ * @brief Assigns the prescaler to the watchdog, Timer 0 runs without a prescaler after it
+ * 
+ * @param prescaler The prescaler
+ *                  @arg WDT_DIV_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Wdt_Init(Wdt_Prescaler_t prescaler)
+{
+    Std_ReturnType error = E_OK;
+    if(prescaler > WDT_DIV_128)
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        /* The Watchdog Is Cleared Before The Prescaler Changes So It Does Not Reset On The Switch */
+        HW_CLEAR_WATCHDOG();
+        HW_OR8(WDT_OPTION_REG, WDT_PSA);
+        HW_AND8(WDT_OPTION_REG, (uint8_t)(WDT_PS_CLR | prescaler));
+        HW_OR8(WDT_OPTION_REG, prescaler);
+    }
+    return error;
+}
+
+/**
+ * @brief Clears the watchdog timer
+ * 
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Wdt_Clear(void)
+{
+    HW_CLEAR_WATCHDOG();
+    return E_OK;
+}
+
+/**
+ * @brief Gets the cause of the last reset from STATUS and PCON, then arms PCON for the next reset,
+ *        it must be called once at boot before the watchdog is cleared
+ * 
+ * @param cause The reset cause
+ *                  @arg WDT_RESET_x
+ * @return Std_ReturnType A Status
+ *                  E_OK : if the function is executed correctly
+ *                  E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Wdt_GetResetCause(Wdt_ResetCause_t* cause)
+{
+    uint8_t pcon = HW_READ8(WDT_PCON);
+    /* BOR Is Unknown After A Power On, So POR Is Checked First */
+    if(!(pcon & WDT_POR))
+    {
+        *cause = WDT_RESET_POWER_ON;
+    }
+    else if(!(pcon & WDT_BOR))
+    {
+        *cause = WDT_RESET_BROWN_OUT;
+    }
+    /* TO Is Cleared By A Watchdog Time Out And Set Again By CLRWDT */
+    else if(!(HW_READ8(WDT_STATUS) & WDT_TO))
+    {
+        *cause = WDT_RESET_WATCHDOG;
+    }
+    else
+    {
+        *cause = WDT_RESET_EXTERNAL;
+    }
+    /* The Hardware Only Clears The Bits, They Are Set To Tell The Next Reset Apart */
+    HW_OR8(WDT_PCON, WDT_POR | WDT_BOR);
+    return E_OK;
+}
@@ -10,9 +10,35 @@
  */
 #ifndef SCHED_H
 #define SCHED_H
+#include "Sched_Cfg.h"
+
+/* The Configured Tasks And The Task Slots For Sched_CreateTask */
+#define SCHED_MAX_TASKS                 (SCHED_NUMBER_OF_TASKS + SCHED_NUMBER_OF_DYNAMIC_TASKS)
 
 typedef void (*taskRunnable_t)(void);
 
+/* A Task Slot Of The Scheduler */
+typedef uint8_t schedHandle_t;
+
+/* The Handle Given When A Task Can Not Be Created */
+#define SCHED_INVALID_HANDLE            0xFF
+
+/* Converts A Time To Scheduler Ticks, It Is Resolved By The Compiler For The Configuration Table */
+#define SCHED_MS_TO_TICKS(timeMS)       ((timeMS) / SCHED_TICK_TIME_MS)
+
+/* A Period Is A Whole Number Of Ticks That Fits The Tick Counters */
+#define SCHED_PERIOD_FITS(periodMS)     ((periodMS) >= SCHED_TICK_TIME_MS && (periodMS) % SCHED_TICK_TIME_MS == 0 && \
+                                         SCHED_MS_TO_TICKS(periodMS) <= SCHED_MAX_TICKS)
+
+/* The Narrowest Tick Counter For The Configured Periods */
+#if SCHED_MAX_TICKS <= 0xFF
+typedef uint8_t schedTicks_t;
+#elif SCHED_MAX_TICKS <= 0xFFFF
+typedef uint16_t schedTicks_t;
+#else
+typedef uint32_t schedTicks_t;
+#endif
+
 typedef struct
 {
     taskRunnable_t runnable;
@@ -20,12 +46,71 @@ typedef struct
 
 }task_t;
 
+/* Overload Classes */
+#define SCHED_TASK_CRITICAL             0
+#define SCHED_TASK_DEFERRABLE           1
+
+/* Execution Contexts */
+#define SCHED_CONTEXT_TASK              0
+#define SCHED_CONTEXT_ISR               1
+
 typedef struct
 {
     const task_t* task;
-    uint32_t delayTicks;
+    /* The Period Of task In Ticks, SCHED_MS_TO_TICKS Of Its periodicTimeMS */
+    schedTicks_t periodTicks;
+    schedTicks_t delayTicks;
+    /* Deferrable Tasks Wait While The Scheduler Is Behind With SCHED_OVERLOAD_DEGRADE */
+    uint8_t deferrable;
+    /* The Higher Priority Runs First, Equal Priorities Keep The Table Order */
+    uint8_t priority;
+    /* SCHED_CONTEXT_ISR Tasks Run From The Compare Match Interrupt When SCHED_ISR_TASKS Is STD_ON,
+       They Preempt The Scan And Must Not Call Sched_SuspendTask Or Sched_Sleep */
+    uint8_t context;
+    /* The Ticks A Running Task Has To Complete A Run In When SCHED_WATCHDOG Is STD_ON, 0 Is Not Supervised,
+       It Must Cover The Period, The Sleeps And The Deferrals Of The Task */
+    schedTicks_t deadlineTicks;
 } sysTaskInfo_t;
 
+/* Asks A Driver If The Core Can Sleep, E_OK When None Of Its Operations Is Running On The Instruction Clock */
+typedef Std_ReturnType (*schedSleepCheck_t)(void);
+
+/* The CPU Load, The Busy Time Of A Scan Is Counted From Its Compare Match Until The Scheduler Goes Idle */
+typedef struct
+{
+    /* The Share Of The Last Window Of SCHED_LOAD_WINDOW_MS Spent Busy In Tenths Of A Percent */
+    uint16_t loadPermille;
+    /* The Longest Busy Time In The Last Window In Tenths Of A Percent Of A Tick, A Scan Longer Than A Tick Counts As 1000 */
+    uint16_t peakPermille;
+    /* The Scans By Busy Time, Bucket i Counts i To i + 1 Times 100 / SCHED_LOAD_BUCKETS Percent Of A Tick And The Last
+       One Counts The Longer Scans Too, All The Buckets Are Halved Before One Overflows */
+    uint16_t histogram[SCHED_LOAD_BUCKETS];
+} schedCpuLoad_t;
+
+/* The Cause Of The Last Reset */
+typedef struct
+{
+    /* WDT_RESET_x */
+    uint8_t cause;
+    /* The Task That Missed Its Deadline Before A Watchdog Reset, SCHED_INVALID_HANDLE If The Watchdog
+       Was Not Cleared For Another Reason */
+    schedHandle_t task;
+} schedResetInfo_t;
+
+/* The Statistics Of A Task, The Times Are In Timer 1 Counts */
+typedef struct
+{
+    uint16_t minExecCounts;
+    uint16_t maxExecCounts;
+    uint16_t avgExecCounts;
+    /* The Delay From The Compare Match To The Start Of The Runnable, The Jitter Is max - min */
+    uint16_t minReleaseCounts;
+    uint16_t maxReleaseCounts;
+    /* The Compare Matches That Came While The Task Was Running */
+    uint16_t missedTicks;
+    uint32_t runs;
+} schedTaskStats_t;
+
 /**
  * @brief The scheduler that will run all the time
  * 
@@ -36,6 +121,8 @@ extern void Sched_Start(void);
  * @brief The initialization for the Scheduler
  * 
  * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if a first delay does not fit SCHED_MAX_TICKS
  */
 extern Std_ReturnType Sched_Init(void);
 
@@ -54,8 +141,143 @@ extern Std_ReturnType Sched_SuspendTask(void);
  * @param timeMS The sleep time in milli seconds
  * @return Std_ReturnType 
  *                 E_OK : if the function is executed correctly
- *                 E_NOT_OK : if the function is not executed correctly
+ *                 E_NOT_OK : if the sleep was cut to SCHED_MAX_TICKS
  */
 extern Std_ReturnType Sched_Sleep(uint32_t timeMS);
 
+/**
+ * @brief Gets the handle of a configured or created task
+ * 
+ * @param task The task
+ * @param handle The handle
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the task is not known
+ */
+extern Std_ReturnType Sched_GetHandle(const task_t* task, schedHandle_t* handle);
+
+/**
+ * @brief Creates a task in a free slot, it starts suspended until Sched_ResumeTask or Sched_ScheduleOnce
+ * 
+ * @param task The task, its period is used by Sched_ResumeTask
+ * @param priority The priority, the task runs in the scan
+ * @param handle The handle, SCHED_INVALID_HANDLE if the task is not created
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if there is no free slot or the period does not fit SCHED_PERIOD_FITS
+ */
+extern Std_ReturnType Sched_CreateTask(const task_t* task, uint8_t priority, schedHandle_t* handle);
+
+/**
+ * @brief Resumes a suspended task or makes a one shot task periodic, it is due on the next tick
+ * 
+ * @param handle The task
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the handle is not valid
+ */
+extern Std_ReturnType Sched_ResumeTask(schedHandle_t handle);
+
+/**
+ * @brief Changes the period of a task, the next release is not moved
+ * 
+ * @param handle The task
+ * @param periodMS The period in milli seconds
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the handle is not valid or the period does not fit SCHED_PERIOD_FITS
+ */
+extern Std_ReturnType Sched_SetPeriod(schedHandle_t handle, uint32_t periodMS);
+
+/**
+ * @brief Runs a suspended task once after a delay, then it is suspended again,
+ *        scheduling a pending one shot task again restarts its delay
+ * 
+ * @param handle The task
+ * @param delayMS The delay in milli seconds, the task runs on the first tick after it
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the handle is not valid, the task is periodic or the delay does not fit SCHED_MAX_TICKS
+ */
+extern Std_ReturnType Sched_ScheduleOnce(schedHandle_t handle, uint32_t delayMS);
+
+/**
+ * @brief Gets the configuration of a task slot
+ * 
+ * @param handle The task slot
+ * @param info The configuration
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the slot is free
+ */
+extern Std_ReturnType Sched_GetTaskInfo(schedHandle_t handle, sysTaskInfo_t* info);
+
+#if SCHED_INSTRUMENTATION == STD_ON
+/**
+ * @brief Gets the execution time, release jitter and missed tick statistics of a task
+ *          It is only available when SCHED_INSTRUMENTATION is STD_ON
+ * 
+ * @param task The task
+ * @param stats The statistics
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the task is not configured
+ */
+extern Std_ReturnType Sched_GetTaskStats(const task_t* task, schedTaskStats_t* stats);
+
+/**
+ * @brief Gets the number of compare matches that came while a previous one was still pending
+ * 
+ * @return uint16_t The number of ticks
+ */
+extern uint16_t Sched_GetLateTicks(void);
+#endif
+
+#if SCHED_WATCHDOG == STD_ON
+/**
+ * @brief Gets the cause of the last reset and the task that missed its deadline before a watchdog reset,
+ *          It is only available when SCHED_WATCHDOG is STD_ON
+ * 
+ * @param info The reset information
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Sched_GetResetInfo(schedResetInfo_t* info);
+#endif
+
+#if SCHED_CPU_LOAD == STD_ON
+/**
+ * @brief Gets the CPU load, the peak busy time and the busy time histogram,
+ *          It is only available when SCHED_CPU_LOAD is STD_ON
+ * 
+ * @param load The CPU load
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+extern Std_ReturnType Sched_GetCpuLoad(schedCpuLoad_t* load);
+#endif
+
+/**
+ * @brief Gets the number of ticks handled by the overload policy, the scans that caught up,
+ *        the skipped ticks or the scans that deferred the deferrable tasks
+ * 
+ * @return uint16_t The number of ticks
+ */
+extern uint16_t Sched_GetOverloadTicks(void);
+
+#ifdef HW_HOST
+/**
+ * @brief Overrides the period of a task for this instance, it is applied by Sched_Init
+ * 
+ * @param task The task
+ * @param periodMS The period in milli seconds, 0 restores the configured period
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the task is not configured or the period does not fit SCHED_PERIOD_FITS
+ */
+extern Std_ReturnType Sched_SetPeriodOverride(const task_t* task, uint32_t periodMS);
+#endif
+
 #endif
\ No newline at end of file
@@ -11,10 +11,80 @@
 #ifndef SCHED_CFG_H
 #define SCHED_CFG_H
 
-#define SCHED_NUMBER_OF_TASKS             4
+#define SCHED_NUMBER_OF_TASKS             5
+
+/* The Task Slots For Sched_CreateTask */
+#define SCHED_NUMBER_OF_DYNAMIC_TASKS     1
 
 #define SCHED_TICK_TIME_MS                5
 
 #define SCHED_SYS_CLK                     2000000
 
+/* The Overload Policies When The Ticks Come Faster Than The Scans Run */
+/* Every Pending Tick Gets Its Own Scan */
+#define SCHED_OVERLOAD_CATCH_UP           0
+/* One Scan Handles All The Pending Ticks, The Extra Ticks Are Counted */
+#define SCHED_OVERLOAD_SKIP               1
+/* Every Pending Tick Gets Its Own Scan But The Deferrable Tasks Wait Until The Backlog Is Cleared */
+#define SCHED_OVERLOAD_DEGRADE            2
+
+#define SCHED_OVERLOAD_POLICY             SCHED_OVERLOAD_CATCH_UP
+
+/* Execution Time, Release Jitter And Missed Tick Instrumentation (STD_ON / STD_OFF), The Host Tools Turn It On Except The Sweep */
+#ifndef SCHED_INSTRUMENTATION
+#define SCHED_INSTRUMENTATION             STD_OFF
+#endif
+
+/* Tasks Configured With SCHED_CONTEXT_ISR Run From The Compare Match Interrupt (STD_ON / STD_OFF),
+   Keep Them Short And Shallow, The Interrupt Shares The 8 Level Hardware Stack With The Deepest Runnable */
+#define SCHED_ISR_TASKS                   STD_OFF
+
+/* The Dispatch Modes */
+/* Every Scan Walks All The Tasks */
+#define SCHED_DISPATCH_SCAN               0
+/* The Tasks Wait In A Delta Queue Sorted By The Due Tick, A Scan Only Touches The Due Tasks */
+#define SCHED_DISPATCH_QUEUE              1
+
+#define SCHED_DISPATCH                    SCHED_DISPATCH_QUEUE
+
+/* The Longest Period, First Delay Or Sleep In Ticks, Up To 0xFF Uses 8-Bit Tick Counters And Up To 0xFFFF Uses 16-Bit Ones */
+#define SCHED_MAX_TICKS                   0xFF
+
+/* Tickless Mode, Timer 1 Is Programmed For The Next Due Task Instead Of Every Tick (STD_ON / STD_OFF)
+   It Skips Ticks Only While No Task Is Due On Them, The 5 ms Switch Task Is Due On Every Tick So It Skips Nothing
+   With The Default Tasks, Turn It On With A Longer SWITCH_TASK_PERIOD_MS */
+#define SCHED_TICKLESS                    STD_OFF
+
+/* Sleep Until Shortly Before The Next Compare Match (STD_ON / STD_OFF), Timer 1 Counts A 32.768 kHz Crystal On
+   T1OSO/T1OSI (RC0/RC1) While The Core Sleeps And Wakes It On Its Overflow, See Timer1_Sleep. It Needs The Crystal,
+   Board 4 Of PICSimLab Has The Fan Tachometer On RC0 And The Buzzer On RC1 So It Is STD_OFF, The Host Build Can Turn It On */
+#ifndef SCHED_SLEEP
+#define SCHED_SLEEP                       STD_OFF
+#endif
+
+/* The Timer 1 Counts From The Wake Up Until The Core Runs, The Oscillator Start-Up Timer Of The 8 MHz HS Crystal (1024 Tosc) */
+#define SCHED_SLEEP_WAKE_COUNTS           256
+
+/* The Shortest Sleep In Crystal Counts, A Shorter Wait Is Spent Awake */
+#define SCHED_SLEEP_MIN_COUNTS            4
+
+/* The Drivers Asked Before Sleeping, Their Operations Run On The Instruction Clock, See Sched_Cfg.c */
+#define SCHED_NUMBER_OF_SLEEP_CHECKS      2
+
+/* Watchdog Supervision (STD_ON / STD_OFF), The Compare Match Interrupt Clears The Watchdog Only While Every Task
+   With A Deadline Completed A Run Within It, WDTE Must Be ON In Cfg.h When It Is STD_ON */
+#define SCHED_WATCHDOG                    STD_ON
+
+/* The Watchdog Prescaler, 1:128 Resets 0.9 To 4.2 Seconds (2.3 Nominal) After The Last Clear */
+#define SCHED_WATCHDOG_PRESCALER          WDT_DIV_128
+
+/* CPU Load Meter (STD_ON / STD_OFF), The Busy Time From A Compare Match Until The Scan Goes Idle Is Read From Timer 1 */
+#define SCHED_CPU_LOAD                    STD_ON
+
+/* The Window Of The Load And Peak Percentages */
+#define SCHED_LOAD_WINDOW_MS              1000
+
+/* The Buckets Of The Busy Time Histogram, Each One Is 100 / SCHED_LOAD_BUCKETS Percent Of A Tick */
+#define SCHED_LOAD_BUCKETS                10
+
 #endif
\ No newline at end of file
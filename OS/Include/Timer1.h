@@ -15,6 +15,9 @@
 #define TMR1_DIV_4				0x20
 #define TMR1_DIV_8  			0x30
 
+/* The Crystal Of The Timer 1 Oscillator On T1OSO/T1OSI (RC0/RC1) In Hz */
+#define TMR1_OSC_CLK                32768UL
+
 typedef uint8_t Timer1_Prescaler_t;
 /**
  * Function:  Timer1_InterruptEnable 
@@ -62,14 +65,27 @@ extern Std_ReturnType Timer1_Start(Timer1_Prescaler_t prescaler);
  * --------------------
  *  @brief Sets The reload time for timer 0
  *
- *  @param timerClock: The Timer clock frequency
+ *  @param timerClock: The Timer clock frequency in Hz, a multiple of 1 KHz
  *  @param timeUS: The time in Micro seconds
  *  
  *  @returns: A status
  *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the time does not fit the 16-bit compare register
+ */
+extern Std_ReturnType Timer1_SetTimeUS(uint32_t timerClock, uint32_t timeUS);
+
+/**
+ * Function:  Timer1_SetCompare 
+ * --------------------
+ *  @brief Sets The compare value for timer 1 in timer counts, it avoids the division of Timer1_SetTimeUS
+ *
+ *  @param counts: The compare value in timer counts
+ *  
+ *  @returns: A status
+ *                 E_OK : if the function is executed correctly
  *                 E_NOT_OK : if the function is not executed correctly
  */
-extern Std_ReturnType Timer1_SetTimeUS(f64 timerClock, uint32_t timeUS);
+extern Std_ReturnType Timer1_SetCompare(uint16_t counts);
 
 /**
  * Function:  Timer1_Stop 
@@ -121,4 +137,22 @@ extern Std_ReturnType Timer1_SetCallBack(interruptCb_t func);
 extern Std_ReturnType Timer1_ClearValue(void);
 
 
-#endif
\ No newline at end of file
+/**
+ * Function:  Timer1_Sleep 
+ * --------------------
+ *  @brief Sleeps the core for a number of crystal counts, Timer 1 counts the 32.768 kHz crystal while the instruction
+ *         clock is stopped and wakes the core on its overflow, then it counts the instruction clock again from the
+ *         value it would have reached so the compare comes at its time. The global interrupt must be disabled and
+ *         no peripheral may be running on the instruction clock
+ *
+ *  @param counts: The crystal counts to sleep, the wake up and the wait for the first edge come on top of them
+ *  @param countCycles: The timer counts of one crystal count in 1/256
+ *  @param wakeCycles: The timer counts from the overflow until the core runs again, the oscillator start-up timer
+ *  
+ *  @returns: A status
+ *                 E_OK : if the core slept until the overflow
+ *                 E_NOT_OK : if an enabled interrupt is pending, the crystal does not count or something else woke the core
+ */
+extern Std_ReturnType Timer1_Sleep(uint16_t counts, uint16_t countCycles, uint16_t wakeCycles);
+
+#endif
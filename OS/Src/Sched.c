@@ -13,42 +13,1110 @@
 #include "Sched.h"
 #include "Int.h"
 #include "Timer1.h"
+#include "Wdt.h"
+#include "Hw.h"
 
 /* Task States */
+#define SCHED_TASK_FREE                  0
 #define SCHED_TASK_RUNNING               1
 #define SCHED_TASK_SUSPENDED             2
-/* Flag States */
-#define FLAG_RAISED                      1
-#define FLAG_LOWERED                     0
+
+/* The Timer 1 Counts Of One Tick */
+#define SCHED_TICK_COUNTS                ((uint32_t)SCHED_SYS_CLK / 1000UL * SCHED_TICK_TIME_MS)
+
+/* The Tick Is A Whole Number Of Timer 1 Counts That Fits The 16-Bit Compare Register */
+STD_STATIC_ASSERT(SCHED_SYS_CLK % 1000UL == 0 && SCHED_TICK_COUNTS > 0 && SCHED_TICK_COUNTS <= 0xFFFFUL, Sched_tickCountsCheck);
+
+#if SCHED_TICKLESS == STD_ON
+/* The Longest Sleep That Fits In The 16-Bit Compare Register */
+#define SCHED_MAX_SLEEP_TICKS            (0xFFFFUL / SCHED_TICK_COUNTS)
+/* The Timer 1 Counts Needed To Write The Compare Register */
+#define SCHED_COMPARE_MARGIN             64
+#endif
+
+#if SCHED_SLEEP == STD_ON
+/* The Timer 1 Counts Of One Crystal Count In 1/256 */
+#define SCHED_SLEEP_COUNT_CYCLES         (SCHED_SYS_CLK / (TMR1_OSC_CLK / 256UL))
+/* The Timer 1 Counts Of One Crystal Count Rounded Up To A Power Of Two, The Shift Gives The Crystal Counts Without A Division */
+#define SCHED_SLEEP_COUNT_SHIFT          6
+/* The Timer 1 Counts Left Awake Before The Compare, The Wake Up, Two Crystal Counts For Its Phase And The Polls
+ * And The Counts Needed To Read Timer 1 Before The Match */
+#define SCHED_SLEEP_MARGIN               (SCHED_SLEEP_WAKE_COUNTS + 2UL * (SCHED_SLEEP_COUNT_CYCLES >> 8) + 64UL)
+
+/* The Instruction Clock Is A Whole Number Of 1/256 Crystal Counts And The Shift Never Sleeps Past The Compare */
+STD_STATIC_ASSERT(SCHED_SYS_CLK % (TMR1_OSC_CLK / 256UL) == 0 && SCHED_SLEEP_COUNT_CYCLES <= 0xFFFFUL, Sched_sleepClockCheck);
+STD_STATIC_ASSERT((256UL << SCHED_SLEEP_COUNT_SHIFT) >= SCHED_SLEEP_COUNT_CYCLES &&
+                  (256UL << SCHED_SLEEP_COUNT_SHIFT) < 2UL * SCHED_SLEEP_COUNT_CYCLES, Sched_sleepShiftCheck);
+#endif
+
+#if SCHED_CPU_LOAD == STD_ON
+/* The Ticks Of A Load Window */
+#define SCHED_LOAD_WINDOW_TICKS          SCHED_MS_TO_TICKS(SCHED_LOAD_WINDOW_MS)
+/* The Busy Time Of One Histogram Bucket */
+#define SCHED_LOAD_BUCKET_COUNTS         (SCHED_TICK_COUNTS / SCHED_LOAD_BUCKETS)
+
+/* The Window Is Whole Ticks And Its Busy Time Fits 32 Bits, A Scan Takes Up To 0xFF Ticks Past It */
+STD_STATIC_ASSERT(SCHED_LOAD_WINDOW_MS >= SCHED_TICK_TIME_MS && SCHED_LOAD_WINDOW_MS % SCHED_TICK_TIME_MS == 0, Sched_loadWindowCheck);
+STD_STATIC_ASSERT(SCHED_LOAD_BUCKETS > 0 && SCHED_LOAD_BUCKET_COUNTS > 0, Sched_loadBucketCheck);
+STD_STATIC_ASSERT(SCHED_LOAD_WINDOW_TICKS + 0xFFUL <= 0xFFFFUL / 2UL &&
+                  (SCHED_LOAD_WINDOW_TICKS + 0xFFUL) * SCHED_TICK_COUNTS <= 0xFFFFFFFFUL / 2UL, Sched_loadRangeCheck);
+#endif
+
+/* The Match Counter Is Kept For The Execution Times And The CPU Load */
+#if SCHED_INSTRUMENTATION == STD_ON || SCHED_CPU_LOAD == STD_ON
+#define SCHED_COUNT_MATCHES              STD_ON
+#else
+#define SCHED_COUNT_MATCHES              STD_OFF
+#endif
+
+/* A Due Task Is Deferred While The Scheduler Is Behind When The Policy Degrades The Deferrable Tasks */
+#if SCHED_OVERLOAD_POLICY == SCHED_OVERLOAD_DEGRADE
+#define SCHED_DEFERRED(task)             (Sched_backlog && SCHED_TASK_DEFERRABLE == Sched_task[task].taskInfo->deferrable)
+#else
+#define SCHED_DEFERRED(task)             0
+#endif
+
+/* The Tasks Run By The Scan, The Interrupt Runs The Rest */
+#if SCHED_ISR_TASKS == STD_ON
+#define SCHED_IN_SCAN(task)              (SCHED_CONTEXT_TASK == Sched_task[task].taskInfo->context)
+#else
+#define SCHED_IN_SCAN(task)              1
+#endif
+
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+/* The End Of The Delta Queue */
+#define SCHED_QUEUE_END                  0xFF
+#endif
+
+/* No Task Is Running */
+#define SCHED_NO_TASK                    0xFF
 
 typedef struct
 {
     const sysTaskInfo_t* taskInfo;
-    uint32_t remainToExec;
-    uint32_t periodTicks;
+    /* The Ticks Until The Task Is Due, In The Delta Queue It Is The Ticks After The Previous Task */
+    schedTicks_t remainToExec;
+    schedTicks_t periodTicks;
     uint8_t state;
     uint32_t sleepTimes;
+    /* The Position In The Priority Order */
+    uint8_t rank;
+    /* The Task Is Suspended Again When It Runs */
+    uint8_t oneShot;
 } sysTask_t;
 
-typedef uint8_t Sched_Flag_t;
-
 extern const sysTaskInfo_t Sched_sysTaskInfo[SCHED_NUMBER_OF_TASKS];
+#if SCHED_SLEEP == STD_ON
+extern const schedSleepCheck_t Sched_sleepChecks[SCHED_NUMBER_OF_SLEEP_CHECKS];
+#endif
+
+static HW_INSTANCE sysTask_t Sched_task[SCHED_MAX_TASKS];
+/* The Task Indices Sorted By Priority */
+static HW_INSTANCE uint8_t Sched_order[SCHED_MAX_TASKS];
+
+#if SCHED_NUMBER_OF_DYNAMIC_TASKS > 0
+/* The Configuration Of The Created Tasks */
+static HW_INSTANCE sysTaskInfo_t Sched_dynamicTaskInfo[SCHED_NUMBER_OF_DYNAMIC_TASKS];
+#endif
+
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+/* The Waiting Tasks Sorted By The Due Tick Then By Priority */
+static HW_INSTANCE uint8_t Sched_queueHead;
+static HW_INSTANCE uint8_t Sched_queueNext[SCHED_MAX_TASKS];
+#endif
+
+/* The Compare Matches Not Handled Yet, Counted By The Interrupt */
+static HW_INSTANCE volatile uint8_t Sched_pendingTicks;
+/* The Compare Matches Still Pending Behind The Running Scan */
+static HW_INSTANCE uint8_t Sched_backlog;
+/* The Ticks Handled By The Overload Policy */
+static HW_INSTANCE uint16_t Sched_overloadTicks;
+
+static HW_INSTANCE volatile uint8_t Sched_taskItr;
+/* The Task Whose Runnable Is Running In The Scan */
+static HW_INSTANCE uint8_t Sched_runningTask = SCHED_NO_TASK;
+
+#if SCHED_TICKLESS == STD_ON
+/* The Ticks Of The Interval Timer 1 Is Counting Now */
+static HW_INSTANCE uint8_t Sched_sleepTicks;
+/* A Task Was Released After The Compare Was Programmed */
+static HW_INSTANCE volatile uint8_t Sched_released;
+#endif
+
+#if SCHED_INSTRUMENTATION == STD_ON
+typedef struct
+{
+    schedTaskStats_t stats;
+    /* The Execution Time Sum Of The Average, Both Are Halved Before The Sum Overflows */
+    uint32_t execSum;
+    uint32_t execRuns;
+} sysTaskStats_t;
+
+static HW_INSTANCE sysTaskStats_t Sched_stats[SCHED_MAX_TASKS];
+/* The Compare Matches Counted When The Scan Started */
+static HW_INSTANCE uint8_t Sched_scanMatches;
+/* The Compare Matches That Came While A Previous One Was Still Pending */
+static HW_INSTANCE uint16_t Sched_lateTicks;
+#endif
+
+#if SCHED_COUNT_MATCHES == STD_ON
+/* The Compare Matches Counted By The Interrupt */
+static HW_INSTANCE volatile uint8_t Sched_matches;
+#endif
+
+#if SCHED_CPU_LOAD == STD_ON
+/* The Compare Matches Counted When The Scheduler Last Went Idle */
+static HW_INSTANCE uint8_t Sched_idleMatches;
+/* A Scan Ran Since The Scheduler Last Went Idle */
+static HW_INSTANCE uint8_t Sched_busy;
+/* The Busy Time, The Longest Busy Time And The Ticks Of The Running Window */
+static HW_INSTANCE uint32_t Sched_windowBusyCounts;
+static HW_INSTANCE uint16_t Sched_windowPeakCounts;
+static HW_INSTANCE uint16_t Sched_windowTicks;
+static HW_INSTANCE schedCpuLoad_t Sched_cpuLoad;
+#endif
+
+#if SCHED_WATCHDOG == STD_ON
+/* The Ticks Left For The Supervised Tasks To Complete A Run, Only The Interrupt Writes Them */
+static HW_INSTANCE uint16_t Sched_aliveTicks[SCHED_MAX_TASKS];
+/* Set When A Task Completed A Run Or Was Released, The Interrupt Reloads The Deadline And Clears It */
+static HW_INSTANCE volatile uint8_t Sched_checkIn[SCHED_MAX_TASKS];
+/* The Task That Missed Its Deadline, It Is Kept Through The Watchdog Reset */
+static HW_PERSISTENT uint8_t Sched_offender;
+static HW_INSTANCE schedResetInfo_t Sched_resetInfo;
+#endif
+
+#ifdef HW_HOST
+/* The Host Tools Tune The Task Periods Per Instance */
+static HW_INSTANCE uint32_t Sched_periodOverrideMS[SCHED_NUMBER_OF_TASKS];
+#endif
+
+#if SCHED_ISR_TASKS == STD_ON
+static void Sched_RunIsrTasks(void);
+#endif
+
+#if SCHED_WATCHDOG == STD_ON
+/**
+ * @brief Counts down the deadlines of the supervised tasks and clears the watchdog if none of them expired,
+ *        it is called from the interrupt
+ * 
+ */
+static void Sched_Supervise(void)
+{
+    uint8_t i;
+    uint8_t alive = 1;
+#if SCHED_TICKLESS == STD_ON
+    uint8_t ticks = Sched_sleepTicks;
+#else
+    uint8_t ticks = 1;
+#endif
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(Sched_checkIn[i])
+        {
+            Sched_checkIn[i] = 0;
+            Sched_aliveTicks[i] = Sched_task[i].taskInfo->deadlineTicks;
+        }
+        else if(0 == Sched_task[i].taskInfo->deadlineTicks || SCHED_TASK_RUNNING != Sched_task[i].state)
+        {
+            /* The Task Is Not Supervised Or It Is Suspended */
+        }
+        else if(Sched_aliveTicks[i] > ticks)
+        {
+            Sched_aliveTicks[i] -= ticks;
+        }
+        else
+        {
+            Sched_aliveTicks[i] = 0;
+            alive = 0;
+            /* A Runnable That Does Not Return Holds Back Every Task Behind It, It Is The One To Blame */
+            if(SCHED_NO_TASK == Sched_offender)
+            {
+                Sched_offender = (SCHED_NO_TASK != Sched_runningTask) ? Sched_runningTask : i;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+    }
+    /* The Watchdog Resets The Device Unless The Tasks Recover Before It Expires */
+    if(alive)
+    {
+        Sched_offender = SCHED_NO_TASK;
+        Wdt_Clear();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+#endif
+
+/**
+ * @brief Counts a compare match, it is called from the interrupt
+ * 
+ */
+static void Sched_CountTick(void)
+{
+#if SCHED_COUNT_MATCHES == STD_ON
+    Sched_matches++;
+#endif
+#if SCHED_INSTRUMENTATION == STD_ON
+    if(Sched_pendingTicks)
+    {
+        Sched_lateTicks++;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+#endif
+    /* The Counter Saturates Instead Of Wrapping Around */
+    if(Sched_pendingTicks < 0xFF)
+    {
+        Sched_pendingTicks++;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+#if SCHED_WATCHDOG == STD_ON
+    Sched_Supervise();
+#endif
+#if SCHED_ISR_TASKS == STD_ON
+    /* The Interrupt Context Tasks Preempt The Scan */
+    Sched_RunIsrTasks();
+#endif
+}
+
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+/**
+ * @brief Inserts a task in the delta queue after the tasks due before it and the higher priority tasks due with it
+ * 
+ * @param task The task index
+ * @param ticks The ticks until the task is due
+ */
+static void Sched_QueueInsert(uint8_t task, schedTicks_t ticks)
+{
+    uint8_t previous = SCHED_QUEUE_END;
+    uint8_t node = Sched_queueHead;
+    while(SCHED_QUEUE_END != node && (Sched_task[node].remainToExec < ticks ||
+          (Sched_task[node].remainToExec == ticks && Sched_task[node].rank < Sched_task[task].rank)))
+    {
+        ticks -= Sched_task[node].remainToExec;
+        previous = node;
+        node = Sched_queueNext[node];
+    }
+    Sched_task[task].remainToExec = ticks;
+    Sched_queueNext[task] = node;
+    if(SCHED_QUEUE_END != node)
+    {
+        /* The Next Task Is Now Due After This One */
+        Sched_task[node].remainToExec -= ticks;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(SCHED_QUEUE_END == previous)
+    {
+        Sched_queueHead = task;
+    }
+    else
+    {
+        Sched_queueNext[previous] = task;
+    }
+}
+
+/**
+ * @brief Charges ticks that passed without a scan to the waiting tasks, only the tasks that become due are touched
+ * 
+ * @param ticks The number of ticks
+ */
+static void Sched_Elapse(uint32_t ticks)
+{
+    uint8_t node = Sched_queueHead;
+    while(ticks && SCHED_QUEUE_END != node)
+    {
+        if(Sched_task[node].remainToExec > ticks)
+        {
+            Sched_task[node].remainToExec -= (schedTicks_t)ticks;
+            ticks = 0;
+        }
+        else
+        {
+            /* The Task Is Late, It Runs In This Scan */
+            ticks -= Sched_task[node].remainToExec;
+            Sched_task[node].remainToExec = 0;
+            node = Sched_queueNext[node];
+        }
+    }
+}
+#else
+/**
+ * @brief Charges ticks that passed without a scan to the running tasks
+ * 
+ * @param ticks The number of ticks
+ */
+static void Sched_Elapse(uint32_t ticks)
+{
+    uint8_t i;
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(!SCHED_IN_SCAN(i))
+        {
+            /* The Interrupt Counts Its Own Tasks */
+        }
+        else if(SCHED_TASK_RUNNING == Sched_task[i].state && Sched_task[i].remainToExec > ticks)
+        {
+            Sched_task[i].remainToExec -= ticks;
+        }
+        else if(SCHED_TASK_RUNNING == Sched_task[i].state)
+        {
+            /* The Task Is Late, It Runs In This Scan */
+            Sched_task[i].remainToExec = 0;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+}
+#endif
+
+/**
+ * @brief Takes the pending compare matches of the next scan according to the overload policy
+ * 
+ * @return uint32_t The ticks that passed for the scan
+ */
+static uint32_t Sched_TakeTicks(void)
+{
+    uint8_t taken;
+    Int_DisableGlobal();
+#if SCHED_OVERLOAD_POLICY == SCHED_OVERLOAD_SKIP
+    /* All The Pending Ticks Are Handled By One Scan */
+    taken = Sched_pendingTicks;
+#else
+    /* Every Pending Tick Gets Its Own Scan */
+    taken = 1;
+#endif
+    Sched_pendingTicks -= taken;
+    Sched_backlog = Sched_pendingTicks;
+#if SCHED_INSTRUMENTATION == STD_ON
+    /* The Scan Belongs To The Oldest Match It Takes */
+    Sched_scanMatches = (uint8_t)(Sched_matches - Sched_backlog - (taken - 1));
+#endif
+    Int_EnableGlobal();
+#if SCHED_OVERLOAD_POLICY == SCHED_OVERLOAD_SKIP
+    Sched_overloadTicks += (uint16_t)(taken - 1);
+#else
+    Sched_overloadTicks += (Sched_backlog ? 1 : 0);
+#endif
+#if SCHED_TICKLESS == STD_ON
+    return (uint32_t)taken * Sched_sleepTicks;
+#else
+    return taken;
+#endif
+}
+
+#if SCHED_INSTRUMENTATION == STD_ON
+/**
+ * @brief Gets the time since the compare match that started the scan
+ * 
+ * @return uint32_t The time in timer 1 counts
+ */
+static uint32_t Sched_Now(void)
+{
+    uint16_t value;
+    uint8_t matches;
+    uint32_t intervalCounts;
+#if SCHED_TICKLESS == STD_ON
+    intervalCounts = (uint32_t)Sched_sleepTicks * SCHED_TICK_COUNTS;
+#else
+    intervalCounts = SCHED_TICK_COUNTS;
+#endif
+    /* Timer 1 Restarts On Every Match, Read Again If A Match Came In Between */
+    do
+    {
+        matches = Sched_matches;
+        Timer1_GetValue(&value);
+    } while(matches != Sched_matches);
+    return (uint32_t)(uint8_t)(matches - Sched_scanMatches) * intervalCounts + value;
+}
+
+/**
+ * @brief Records one run of a task
+ * 
+ * @param task The task index
+ * @param start The time the runnable was called since the compare match
+ * @param exec The execution time
+ * @param missed The compare matches that came while the runnable ran
+ */
+static void Sched_Record(uint8_t task, uint32_t start, uint32_t exec, uint8_t missed)
+{
+    sysTaskStats_t* item = &Sched_stats[task];
+    uint16_t release = (start > 0xFFFF) ? 0xFFFF : (uint16_t)start;
+    if(exec > 0xFFFF)
+    {
+        exec = 0xFFFF;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(item->stats.runs == 0 || exec < item->stats.minExecCounts)
+    {
+        item->stats.minExecCounts = (uint16_t)exec;
+    }
+    if(exec > item->stats.maxExecCounts)
+    {
+        item->stats.maxExecCounts = (uint16_t)exec;
+    }
+    if(item->stats.runs == 0 || release < item->stats.minReleaseCounts)
+    {
+        item->stats.minReleaseCounts = release;
+    }
+    if(release > item->stats.maxReleaseCounts)
+    {
+        item->stats.maxReleaseCounts = release;
+    }
+    if(item->execSum > 0xFFFFFFFFUL - exec)
+    {
+        item->execSum >>= 1;
+        item->execRuns >>= 1;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    item->execSum += exec;
+    item->execRuns++;
+    item->stats.runs++;
+    /* The Matches While The Task Ran Were Late Or Swallowed Because Of It */
+    item->stats.missedTicks += missed;
+}
+#endif
+
+#if SCHED_ISR_TASKS == STD_ON
+/**
+ * @brief Runs the due interrupt context tasks, it is called from the interrupt
+ *        right after the match so Timer 1 holds the time since the match
+ * 
+ */
+static void Sched_RunIsrTasks(void)
+{
+    uint8_t i;
+    uint8_t task;
+#if SCHED_TICKLESS == STD_ON
+    uint8_t ticks = Sched_sleepTicks;
+#else
+    uint8_t ticks = 1;
+#endif
+#if SCHED_INSTRUMENTATION == STD_ON
+    uint16_t start;
+    uint16_t end;
+#endif
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        task = Sched_order[i];
+        if(SCHED_TASK_RUNNING == Sched_task[task].state && !SCHED_IN_SCAN(task))
+        {
+            /* The Remaining Ticks Count To The Match That Runs The Task */
+            if(Sched_task[task].remainToExec <= ticks)
+            {
+                Sched_task[task].remainToExec = Sched_task[task].periodTicks;
+                if(Sched_task[task].oneShot)
+                {
+                    Sched_task[task].oneShot = 0;
+                    Sched_task[task].state = SCHED_TASK_SUSPENDED;
+                }
+                else
+                {
+                    /* Empty Else To Satisfy The Misra Rules */
+                }
+#if SCHED_INSTRUMENTATION == STD_ON
+                Timer1_GetValue(&start);
+#endif
+                Sched_task[task].taskInfo->task->runnable();
+#if SCHED_INSTRUMENTATION == STD_ON
+                Timer1_GetValue(&end);
+                Sched_Record(task, start, (uint16_t)(end - start), 0);
+#endif
+#if SCHED_WATCHDOG == STD_ON
+                Sched_checkIn[task] = 1;
+#endif
+            }
+            else
+            {
+                Sched_task[task].remainToExec -= ticks;
+            }
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+}
+#endif
+
+#if SCHED_TICKLESS == STD_ON
+/**
+ * @brief Programs the compare for the next due task, it runs at the start of the scan
+ *        so Timer 1 is normally still far below the next compare value
+ * 
+ */
+static void Sched_ProgramNextWakeup(void)
+{
+    uint8_t i;
+    uint16_t now;
+    uint32_t next = SCHED_MAX_SLEEP_TICKS;
+    uint32_t due;
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+    uint8_t node = Sched_queueHead;
+    /* The Due Tasks Come Back After Their Period */
+    while(SCHED_QUEUE_END != node && 0 == Sched_task[node].remainToExec)
+    {
+        if(Sched_task[node].periodTicks < next)
+        {
+            next = Sched_task[node].periodTicks;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        node = Sched_queueNext[node];
+    }
+    /* The First Waiting Task */
+    if(SCHED_QUEUE_END != node && Sched_task[node].remainToExec < next)
+    {
+        next = Sched_task[node].remainToExec;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+#endif
+#if SCHED_ISR_TASKS == STD_ON
+    /* The Interrupt Context Tasks Count Down In The Interrupt */
+    Int_DisableGlobal();
+#endif
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+        /* Only The Interrupt Context Tasks Are Outside The Queue */
+        if(SCHED_TASK_RUNNING == Sched_task[i].state && !SCHED_IN_SCAN(i))
+#else
+        if(SCHED_TASK_RUNNING == Sched_task[i].state)
+#endif
+        {
+            /* The Ticks Until The Task Is Due After This Scan, An Interrupt Context Task Counts To Its Match */
+            due = (0 == Sched_task[i].remainToExec && SCHED_IN_SCAN(i)) ? Sched_task[i].periodTicks : Sched_task[i].remainToExec;
+            if(due < next)
+            {
+                next = due;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+#if SCHED_ISR_TASKS == STD_ON
+    Int_EnableGlobal();
+#endif
+    if(next == 0)
+    {
+        next = 1;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    /* Timer 1 Has Been Counting Since The Match, Keep The Compare Ahead Of It When The Scan Started Late */
+    Timer1_GetValue(&now);
+    while(next < SCHED_MAX_SLEEP_TICKS && next * SCHED_TICK_COUNTS <= (uint32_t)now + SCHED_COMPARE_MARGIN)
+    {
+        next++;
+    }
+    /* Timer 1 Restarts On The Match, The Compare Of The Same Interval Is Still Programmed */
+    if(next != Sched_sleepTicks)
+    {
+        Sched_sleepTicks = (uint8_t)next;
+        Timer1_SetCompare((uint16_t)(next * SCHED_TICK_COUNTS));
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    /* The Releases Made Before Are Counted In This Compare */
+    Sched_released = 0;
+}
 
-static sysTask_t Sched_task[SCHED_NUMBER_OF_TASKS];
+/**
+ * @brief Pulls the compare in when a task was released to be due before it, it runs between
+ *        the scans so the remaining ticks of the scan tasks already count the last tick
+ * 
+ */
+static void Sched_PullWakeup(void)
+{
+    uint8_t i;
+    uint16_t now;
+    uint32_t next = Sched_sleepTicks;
+    uint32_t due;
+    Sched_released = 0;
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+    /* The Head Is The First Task Due In The Scan */
+    if(SCHED_QUEUE_END != Sched_queueHead && Sched_task[Sched_queueHead].remainToExec + 1UL < next)
+    {
+        next = Sched_task[Sched_queueHead].remainToExec + 1UL;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+#endif
+#if SCHED_ISR_TASKS == STD_ON
+    /* The Interrupt Context Tasks Count Down In The Interrupt */
+    Int_DisableGlobal();
+#endif
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+        if(SCHED_TASK_RUNNING == Sched_task[i].state && !SCHED_IN_SCAN(i))
+#else
+        if(SCHED_TASK_RUNNING == Sched_task[i].state)
+#endif
+        {
+            /* A Scan Task Runs On The Match After Its Remaining Ticks, An Interrupt Context Task On The Match That Reaches Them */
+            due = SCHED_IN_SCAN(i) ? Sched_task[i].remainToExec + 1UL : Sched_task[i].remainToExec;
+            if(due < next)
+            {
+                next = due;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+#if SCHED_ISR_TASKS == STD_ON
+    Int_EnableGlobal();
+#endif
+    if(next == 0)
+    {
+        next = 1;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    /* The Compare Can Only Move Ahead Of Timer 1, A Pending Match Already Ended The Interval */
+    Timer1_GetValue(&now);
+    while(next < Sched_sleepTicks && next * SCHED_TICK_COUNTS <= (uint32_t)now + SCHED_COMPARE_MARGIN)
+    {
+        next++;
+    }
+    if(next < Sched_sleepTicks && 0 == Sched_pendingTicks)
+    {
+        Sched_sleepTicks = (uint8_t)next;
+        Timer1_SetCompare((uint16_t)(next * SCHED_TICK_COUNTS));
+    }
+    else
+    {
+        /* The Programmed Compare Comes First */
+    }
+}
+#endif
+
+/**
+ * @brief Runs a due task and reloads its ticks, a deferred task stays due
+ * 
+ * @param task The task index
+ */
+static void Sched_Run(uint8_t task)
+{
+#if SCHED_INSTRUMENTATION == STD_ON
+    uint32_t start;
+    uint8_t startMatches;
+#endif
+    if(SCHED_DEFERRED(task))
+    {
+        /* The Task Stays Due Until The Backlog Is Cleared */
+        Sched_task[task].remainToExec = 1;
+    }
+    else
+    {
+        Sched_task[task].remainToExec = Sched_task[task].periodTicks;
+        /* A One Shot Task Is Suspended Unless The Runnable Releases It Again */
+        if(Sched_task[task].oneShot)
+        {
+            Sched_task[task].oneShot = 0;
+            Sched_task[task].state = SCHED_TASK_SUSPENDED;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        Sched_runningTask = task;
+#if SCHED_INSTRUMENTATION == STD_ON
+        startMatches = Sched_matches;
+        start = Sched_Now();
+#endif
+        Sched_task[task].taskInfo->task->runnable();
+#if SCHED_INSTRUMENTATION == STD_ON
+        Sched_Record(task, start, Sched_Now() - start, (uint8_t)(Sched_matches - startMatches));
+#endif
+#if SCHED_WATCHDOG == STD_ON
+        /* The Task Is Alive, The Interrupt Starts Its Next Deadline */
+        Sched_checkIn[task] = 1;
+#endif
+        Sched_runningTask = SCHED_NO_TASK;
+    }
+}
 
-static volatile Sched_Flag_t Sched_flag;
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+/**
+ * @brief Runs the due tasks at the head of the delta queue in the priority order
+ * 
+ */
+static void Sched_Dispatch(void)
+{
+    while(SCHED_QUEUE_END != Sched_queueHead && 0 == Sched_task[Sched_queueHead].remainToExec)
+    {
+        Sched_taskItr = Sched_queueHead;
+        Sched_queueHead = Sched_queueNext[Sched_taskItr];
+        Sched_Run(Sched_taskItr);
+        /* A Suspended Task Leaves The Queue */
+        if(SCHED_TASK_RUNNING == Sched_task[Sched_taskItr].state)
+        {
+            Sched_QueueInsert(Sched_taskItr, Sched_task[Sched_taskItr].remainToExec);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    /* The Tick Of This Scan, The Head Is Not Due Anymore */
+    if(SCHED_QUEUE_END != Sched_queueHead)
+    {
+        Sched_task[Sched_queueHead].remainToExec--;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+#else
+/**
+ * @brief Walks all the tasks in the priority order and runs the due ones
+ * 
+ */
+static void Sched_Dispatch(void)
+{
+    uint8_t i;
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        Sched_taskItr = Sched_order[i];
+        if(SCHED_TASK_RUNNING == Sched_task[Sched_taskItr].state && SCHED_IN_SCAN(Sched_taskItr))
+        {
+            /* If The Task Is Ready To Execute */
+            if(0 == Sched_task[Sched_taskItr].remainToExec)
+            {
+                Sched_Run(Sched_taskItr);
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+            Sched_task[Sched_taskItr].remainToExec--;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        /* A Task Created By The Runnable Can Move The Order */
+        i = Sched_task[Sched_taskItr].rank;
+    }
+}
+#endif
+
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+/**
+ * @brief Takes a waiting task out of the delta queue, the next task keeps its due tick
+ * 
+ * @param task The task index
+ */
+static void Sched_QueueRemove(uint8_t task)
+{
+    uint8_t previous = SCHED_QUEUE_END;
+    uint8_t node = Sched_queueHead;
+    while(SCHED_QUEUE_END != node && task != node)
+    {
+        previous = node;
+        node = Sched_queueNext[node];
+    }
+    if(SCHED_QUEUE_END != node)
+    {
+        node = Sched_queueNext[task];
+        if(SCHED_QUEUE_END != node)
+        {
+            Sched_task[node].remainToExec += Sched_task[task].remainToExec;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        if(SCHED_QUEUE_END == previous)
+        {
+            Sched_queueHead = node;
+        }
+        else
+        {
+            Sched_queueNext[previous] = node;
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+#endif
+
+/**
+ * @brief Makes a task due after some ticks
+ * 
+ * @param task The task index
+ * @param ticks The ticks until the task is due
+ */
+static void Sched_Release(uint8_t task, schedTicks_t ticks)
+{
+#if SCHED_WATCHDOG == STD_ON
+    /* A Suspended Task Starts A New Deadline */
+    Sched_checkIn[task] = 1;
+#endif
+#if SCHED_TICKLESS == STD_ON
+    /* The Task Can Be Due Before The Programmed Compare */
+    Sched_released = 1;
+#endif
+    if(!SCHED_IN_SCAN(task))
+    {
+        /* The Interrupt Counts The Ticks Of Its Tasks */
+        Int_DisableGlobal();
+        Sched_task[task].remainToExec = ticks;
+        Sched_task[task].state = SCHED_TASK_RUNNING;
+        Int_EnableGlobal();
+    }
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+    else if(task == Sched_runningTask)
+    {
+        /* The Running Task Is Queued When Its Runnable Returns */
+        Sched_task[task].remainToExec = ticks;
+        Sched_task[task].state = SCHED_TASK_RUNNING;
+    }
+    else
+    {
+        if(SCHED_TASK_RUNNING == Sched_task[task].state)
+        {
+            Sched_QueueRemove(task);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        Sched_task[task].state = SCHED_TASK_RUNNING;
+        Sched_QueueInsert(task, ticks);
+    }
+#else
+    else
+    {
+        Sched_task[task].remainToExec = ticks;
+        Sched_task[task].state = SCHED_TASK_RUNNING;
+    }
+#endif
+}
+
+#if SCHED_NUMBER_OF_DYNAMIC_TASKS > 0
+/**
+ * @brief Moves a created task to its place in the priority order
+ * 
+ * @param task The task index
+ */
+static void Sched_Reorder(uint8_t task)
+{
+    uint8_t i;
+    uint8_t j = 0;
+    /* The Interrupt Walks The Order */
+    Int_DisableGlobal();
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(task != Sched_order[i])
+        {
+            Sched_order[j++] = Sched_order[i];
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    /* Insert The Task After The Tasks Of Higher Or Equal Priority, The Free Slots Stay Last */
+    for(j=SCHED_MAX_TASKS-1; j>0 && (SCHED_TASK_FREE == Sched_task[Sched_order[j-1]].state ||
+        Sched_task[Sched_order[j-1]].taskInfo->priority < Sched_task[task].taskInfo->priority); j--)
+    {
+        Sched_order[j] = Sched_order[j-1];
+    }
+    Sched_order[j] = task;
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        Sched_task[Sched_order[i]].rank = i;
+    }
+    Int_EnableGlobal();
+}
+#endif
 
-static volatile uint8_t Sched_taskItr;
+#if SCHED_CPU_LOAD == STD_ON
+/**
+ * @brief Records the busy time from the compare match that woke the scheduler until now,
+ *        it runs once when the scheduler goes idle
+ * 
+ */
+static void Sched_RecordLoad(void)
+{
+    uint16_t value;
+    uint8_t matches;
+    uint8_t i;
+    uint32_t intervalCounts;
+    uint32_t busy;
+    uint32_t bound = SCHED_LOAD_BUCKET_COUNTS;
+#if SCHED_TICKLESS == STD_ON
+    intervalCounts = (uint32_t)Sched_sleepTicks * SCHED_TICK_COUNTS;
+#else
+    intervalCounts = SCHED_TICK_COUNTS;
+#endif
+    /* Timer 1 Restarts On Every Match, Read Again If A Match Came In Between */
+    do
+    {
+        matches = Sched_matches;
+        Timer1_GetValue(&value);
+    } while(matches != Sched_matches);
+    /* The First Match After The Last Idle Woke The Scheduler, The Later Ones Came While It Was Busy */
+    busy = (uint32_t)(uint8_t)(matches - Sched_idleMatches - 1) * intervalCounts + value;
+    Sched_idleMatches = matches;
+    Sched_windowBusyCounts += busy;
+    if(busy > Sched_windowPeakCounts)
+    {
+        Sched_windowPeakCounts = (busy > 0xFFFF) ? 0xFFFF : (uint16_t)busy;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    /* The Last Bucket Takes The Longer Scans */
+    i = 0;
+    while(i < SCHED_LOAD_BUCKETS - 1 && busy >= bound)
+    {
+        bound += SCHED_LOAD_BUCKET_COUNTS;
+        i++;
+    }
+    if(0xFFFF == Sched_cpuLoad.histogram[i])
+    {
+        /* Halve All The Buckets So They Keep Their Ratios */
+        for(i=0; i<SCHED_LOAD_BUCKETS; i++)
+        {
+            Sched_cpuLoad.histogram[i] >>= 1;
+        }
+        /* Find The Bucket Again */
+        i = 0;
+        bound = SCHED_LOAD_BUCKET_COUNTS;
+        while(i < SCHED_LOAD_BUCKETS - 1 && busy >= bound)
+        {
+            bound += SCHED_LOAD_BUCKET_COUNTS;
+            i++;
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    Sched_cpuLoad.histogram[i]++;
+    /* Close The Window */
+    if(Sched_windowTicks >= SCHED_LOAD_WINDOW_TICKS)
+    {
+        /* The Busy Counts Per Tick Times 1000 Fit 32 Bits Where The Window Sum Would Not */
+        busy = Sched_windowBusyCounts / Sched_windowTicks * 1000UL / SCHED_TICK_COUNTS;
+        Sched_cpuLoad.loadPermille = (busy > 1000) ? 1000 : (uint16_t)busy;
+        busy = (uint32_t)Sched_windowPeakCounts * 1000UL / SCHED_TICK_COUNTS;
+        Sched_cpuLoad.peakPermille = (busy > 1000) ? 1000 : (uint16_t)busy;
+        Sched_windowBusyCounts = 0;
+        Sched_windowPeakCounts = 0;
+        Sched_windowTicks = 0;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+#endif
 
+#if SCHED_SLEEP == STD_ON
 /**
- * @brief Sets the scheduler flag
+ * @brief Sleeps until shortly before the next compare match, the core stays awake while a driver is busy
+ *        or a task missed its deadline since SLEEP clears the watchdog
  * 
+ * @return Std_ReturnType 
+ *                 E_OK : if the core slept
+ *                 E_NOT_OK : if the wait is too short or the core has to stay awake
  */
-static void Sched_SetFlag(void)
+static Std_ReturnType Sched_PowerDown(void)
 {
-    /* Raise The Tick Flag */
-    Sched_flag = FLAG_RAISED;
+    uint8_t i;
+    uint16_t now;
+    uint32_t left;
+    uint32_t intervalCounts;
+    Std_ReturnType error = E_OK;
+#if SCHED_TICKLESS == STD_ON
+    intervalCounts = (uint32_t)Sched_sleepTicks * SCHED_TICK_COUNTS;
+#else
+    intervalCounts = SCHED_TICK_COUNTS;
+#endif
+    /* A Match After The Checks Is Pending When Timer 1 Sleeps, It Does Not Sleep Then */
+    Int_DisableGlobal();
+    for(i=0; i<SCHED_NUMBER_OF_SLEEP_CHECKS && E_OK == error; i++)
+    {
+        error = Sched_sleepChecks[i]();
+    }
+#if SCHED_WATCHDOG == STD_ON
+    if(SCHED_NO_TASK != Sched_offender)
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+#endif
+    Timer1_GetValue(&now);
+    left = (intervalCounts > now) ? intervalCounts - now : 0;
+    if(E_OK == error && 0 == Sched_pendingTicks && left >= SCHED_SLEEP_MARGIN + ((uint32_t)SCHED_SLEEP_MIN_COUNTS << SCHED_SLEEP_COUNT_SHIFT))
+    {
+        error = Timer1_Sleep((uint16_t)((left - SCHED_SLEEP_MARGIN) >> SCHED_SLEEP_COUNT_SHIFT), SCHED_SLEEP_COUNT_CYCLES, SCHED_SLEEP_WAKE_COUNTS);
+    }
+    else
+    {
+        error = E_NOT_OK;
+    }
+    Int_EnableGlobal();
+    return error;
 }
+#endif
 
 /**
  * @brief The scheduler that will run all the time
@@ -56,41 +1124,76 @@ static void Sched_SetFlag(void)
  */
 void Sched_Start(void)
 {
+#if SCHED_CPU_LOAD == STD_ON
+    uint32_t ticks;
+#endif
     Timer1_Start(TMR1_DIV_1);
     while(1)
     {
-        /* If The Flag Is Raised */
-        if(Sched_flag == FLAG_RAISED)
+        /* If A Tick Is Pending */
+        if(Sched_pendingTicks)
         {
-            /* Lower The Flag */
-            Sched_flag = FLAG_LOWERED;
-            for(Sched_taskItr=0; Sched_taskItr<SCHED_NUMBER_OF_TASKS; Sched_taskItr++)
+            /* One Tick Is For The Scan, The Rest Passed Without A Scan */
+#if SCHED_CPU_LOAD == STD_ON
+            ticks = Sched_TakeTicks();
+            Sched_windowTicks += (uint16_t)ticks;
+            Sched_busy = 1;
+            Sched_Elapse(ticks - 1);
+#else
+            Sched_Elapse(Sched_TakeTicks() - 1);
+#endif
+#if SCHED_TICKLESS == STD_ON
+            /* The Pending Matches Keep The Interval They Were Programmed With */
+            if(0 == Sched_backlog)
             {
-                if(SCHED_TASK_RUNNING == Sched_task[Sched_taskItr].state)
-                {
-                    /* If The Task Is Ready To Execute */
-                    if(0 == Sched_task[Sched_taskItr].remainToExec)
-                    {
-                        Sched_task[Sched_taskItr].remainToExec = Sched_task[Sched_taskItr].periodTicks;
-                        Sched_task[Sched_taskItr].taskInfo->task->runnable();
-                    }
-                    else
-                    {
-                        /* Empty Else To Satisfy The Misra Rules */
-                    }
-                    
-                    Sched_task[Sched_taskItr].remainToExec--;
-                }
-                else
-                {
-                    /* Empty Else To Satisfy The Misra Rules */
-                }
-                
+                Sched_ProgramNextWakeup();
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
             }
+#endif
+            /* The Due Tasks Run In The Priority Order */
+            Sched_Dispatch();
         }
         else
         {
-            /* Empty Else To Satisfy The Misra Rules */
+#if SCHED_CPU_LOAD == STD_ON
+            /* The Busy Time Ends When The Scheduler First Finds Nothing To Do */
+            if(Sched_busy)
+            {
+                Sched_busy = 0;
+                Sched_RecordLoad();
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+#endif
+#if SCHED_TICKLESS == STD_ON
+            /* A Task Released By A Runnable Wakes The Scheduler On Its Own Tick */
+            if(Sched_released)
+            {
+                Sched_PullWakeup();
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+#endif
+            /* Nothing To Do Until The Next Compare Match */
+#if SCHED_SLEEP == STD_ON
+            if(E_OK != Sched_PowerDown())
+            {
+                HW_IDLE();
+            }
+            else
+            {
+                /* The Core Slept, The Match Comes Shortly */
+            }
+#else
+            HW_IDLE();
+#endif
         }
         
     }
@@ -100,25 +1203,107 @@ void Sched_Start(void)
  * @brief The initialization for the Scheduler
  * 
  * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if a period or a first delay does not fit SCHED_MAX_TICKS
  */
 Std_ReturnType Sched_Init(void)
 {
     uint8_t i;
+    uint8_t j;
+    Std_ReturnType error = E_OK;
+#if SCHED_WATCHDOG == STD_ON
+    /* The Reset Cause Is Read Before The First Clear Of The Watchdog Sets TO Again */
+    Wdt_GetResetCause(&Sched_resetInfo.cause);
+    Sched_resetInfo.task = (WDT_RESET_WATCHDOG == Sched_resetInfo.cause && Sched_offender < SCHED_MAX_TASKS) ?
+                           Sched_offender : SCHED_INVALID_HANDLE;
+    Sched_offender = SCHED_NO_TASK;
+    Wdt_Init(SCHED_WATCHDOG_PRESCALER);
+#endif
     for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
     {
         /* Initialize Tasks */
         Sched_task[i].taskInfo = &Sched_sysTaskInfo[i];
         Sched_task[i].remainToExec = Sched_task[i].taskInfo->delayTicks;
-        Sched_task[i].periodTicks = Sched_task[i].taskInfo->task->periodicTimeMS / SCHED_TICK_TIME_MS;
+#if SCHED_WATCHDOG == STD_ON
+        /* The First Deadline Starts After The First Delay */
+        Sched_aliveTicks[i] = (uint16_t)Sched_task[i].taskInfo->delayTicks + Sched_task[i].taskInfo->deadlineTicks;
+        Sched_checkIn[i] = 0;
+#endif
+        /* An Interrupt Context Task Counts To The Match That Runs It, The Scan Of The Same Tick Comes After The Match */
+        if(!SCHED_IN_SCAN(i))
+        {
+            Sched_task[i].remainToExec++;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        /* Insert The Task After The Tasks Of Higher Or Equal Priority */
+        for(j=i; j>0 && Sched_sysTaskInfo[Sched_order[j-1]].priority < Sched_task[i].taskInfo->priority; j--)
+        {
+            Sched_order[j] = Sched_order[j-1];
+        }
+        Sched_order[j] = i;
+        /* The Periods Are Checked And Converted To Ticks By The Compiler In Sched_Cfg.c */
+        Sched_task[i].periodTicks = Sched_task[i].taskInfo->periodTicks;
+#ifdef HW_HOST
+        if(Sched_periodOverrideMS[i])
+        {
+            Sched_task[i].periodTicks = (schedTicks_t)SCHED_MS_TO_TICKS(Sched_periodOverrideMS[i]);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+#endif
+        /* The Delays Must Fit The Tick Counters */
+        if(Sched_task[i].taskInfo->delayTicks >= SCHED_MAX_TICKS)
+        {
+            error = E_NOT_OK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
         Sched_task[i].state = SCHED_TASK_RUNNING;
     }
+#if SCHED_NUMBER_OF_DYNAMIC_TASKS > 0
+    for(i=SCHED_NUMBER_OF_TASKS; i<SCHED_MAX_TASKS; i++)
+    {
+        /* The Slots Of Sched_CreateTask Are Free And Come Last In The Order */
+        Sched_task[i].taskInfo = &Sched_dynamicTaskInfo[i - SCHED_NUMBER_OF_TASKS];
+        Sched_task[i].state = SCHED_TASK_FREE;
+        Sched_order[i] = i;
+    }
+#endif
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        Sched_task[Sched_order[i]].rank = i;
+    }
+#if SCHED_DISPATCH == SCHED_DISPATCH_QUEUE
+    Sched_queueHead = SCHED_QUEUE_END;
+    for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
+    {
+        if(SCHED_IN_SCAN(i))
+        {
+            Sched_QueueInsert(i, Sched_task[i].remainToExec);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+#endif
     /* Initialize Timer 1 */
     Timer1_Stop();
-    Timer1_SetTimeUS((f64)SCHED_SYS_CLK, SCHED_TICK_TIME_MS*1000);
-    Timer1_SetCallBack(Sched_SetFlag);
+    Timer1_SetCompare((uint16_t)SCHED_TICK_COUNTS);
+#if SCHED_TICKLESS == STD_ON
+    Sched_sleepTicks = 1;
+#endif
+    Timer1_SetCallBack(Sched_CountTick);
     Timer1_ClearValue();
     Timer1_InterruptEnable();
-    return E_OK;
+    return error;
 }
 
 /**
@@ -140,11 +1325,318 @@ Std_ReturnType Sched_SuspendTask(void)
  * @param timeMS The sleep time in milli seconds
  * @return Std_ReturnType 
  *                 E_OK : if the function is executed correctly
- *                 E_NOT_OK : if the function is not executed correctly
+ *                 E_NOT_OK : if the sleep was cut to SCHED_MAX_TICKS
  */
 Std_ReturnType Sched_Sleep(uint32_t timeMS)
 {
     uint32_t times = timeMS / SCHED_TICK_TIME_MS;
-    Sched_task[Sched_taskItr].remainToExec += times;
+    Std_ReturnType error = E_OK;
+    /* The Sleep Is Cut To Fit The Tick Counter */
+    if(times > (uint32_t)(SCHED_MAX_TICKS - Sched_task[Sched_taskItr].remainToExec))
+    {
+        times = SCHED_MAX_TICKS - Sched_task[Sched_taskItr].remainToExec;
+        error = E_NOT_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    Sched_task[Sched_taskItr].remainToExec += (schedTicks_t)times;
+    return error;
+}
+
+/**
+ * @brief Gets the handle of a configured or created task
+ * 
+ * @param task The task
+ * @param handle The handle
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the task is not known
+ */
+Std_ReturnType Sched_GetHandle(const task_t* task, schedHandle_t* handle)
+{
+    uint8_t i;
+    Std_ReturnType error = E_NOT_OK;
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(SCHED_TASK_FREE != Sched_task[i].state && Sched_task[i].taskInfo->task == task)
+        {
+            *handle = i;
+            error = E_OK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return error;
+}
+
+/**
+ * @brief Creates a task in a free slot, it starts suspended until Sched_ResumeTask or Sched_ScheduleOnce
+ * 
+ * @param task The task, its period is used by Sched_ResumeTask
+ * @param priority The priority, the task runs in the scan
+ * @param handle The handle, SCHED_INVALID_HANDLE if the task is not created
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if there is no free slot or the period does not fit SCHED_MAX_TICKS
+ */
+Std_ReturnType Sched_CreateTask(const task_t* task, uint8_t priority, schedHandle_t* handle)
+{
+    Std_ReturnType error = E_NOT_OK;
+#if SCHED_NUMBER_OF_DYNAMIC_TASKS > 0
+    uint8_t i;
+    sysTaskInfo_t* info;
+#endif
+    *handle = SCHED_INVALID_HANDLE;
+#if SCHED_NUMBER_OF_DYNAMIC_TASKS > 0
+    for(i=SCHED_NUMBER_OF_TASKS; i<SCHED_MAX_TASKS && E_NOT_OK == error; i++)
+    {
+        if(SCHED_TASK_FREE == Sched_task[i].state && SCHED_PERIOD_FITS(task->periodicTimeMS))
+        {
+            info = &Sched_dynamicTaskInfo[i - SCHED_NUMBER_OF_TASKS];
+            info->task = task;
+            info->periodTicks = (schedTicks_t)SCHED_MS_TO_TICKS(task->periodicTimeMS);
+            info->delayTicks = 0;
+            info->deadlineTicks = 0;
+            info->deferrable = SCHED_TASK_CRITICAL;
+            info->priority = priority;
+            info->context = SCHED_CONTEXT_TASK;
+            Sched_task[i].periodTicks = info->periodTicks;
+            Sched_task[i].remainToExec = 0;
+            Sched_task[i].oneShot = 0;
+            Sched_task[i].state = SCHED_TASK_SUSPENDED;
+            Sched_Reorder(i);
+            *handle = i;
+            error = E_OK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+#endif
+    return error;
+}
+
+/**
+ * @brief Resumes a suspended task or makes a one shot task periodic, it is due on the next tick
+ * 
+ * @param handle The task
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the handle is not valid
+ */
+Std_ReturnType Sched_ResumeTask(schedHandle_t handle)
+{
+    Std_ReturnType error = E_OK;
+    if(handle >= SCHED_MAX_TASKS || SCHED_TASK_FREE == Sched_task[handle].state)
+    {
+        error = E_NOT_OK;
+    }
+    else if(SCHED_TASK_SUSPENDED == Sched_task[handle].state || Sched_task[handle].oneShot)
+    {
+        Sched_task[handle].oneShot = 0;
+        Sched_Release(handle, 1);
+    }
+    else
+    {
+        /* The Task Is Already Periodic */
+    }
+    return error;
+}
+
+/**
+ * @brief Changes the period of a task, the next release is not moved
+ * 
+ * @param handle The task
+ * @param periodMS The period in milli seconds
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the handle is not valid or the period does not fit SCHED_MAX_TICKS
+ */
+Std_ReturnType Sched_SetPeriod(schedHandle_t handle, uint32_t periodMS)
+{
+    Std_ReturnType error = E_OK;
+    if(handle >= SCHED_MAX_TASKS || SCHED_TASK_FREE == Sched_task[handle].state || !SCHED_PERIOD_FITS(periodMS))
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        /* The Interrupt Context Tasks Reload Their Period In The Interrupt */
+        Int_DisableGlobal();
+        Sched_task[handle].periodTicks = (schedTicks_t)SCHED_MS_TO_TICKS(periodMS);
+        Int_EnableGlobal();
+    }
+    return error;
+}
+
+/**
+ * @brief Runs a suspended task once after a delay, then it is suspended again,
+ *        scheduling a pending one shot task again restarts its delay
+ * 
+ * @param handle The task
+ * @param delayMS The delay in milli seconds, the task runs on the first tick after it
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the handle is not valid, the task is periodic or the delay does not fit SCHED_MAX_TICKS
+ */
+Std_ReturnType Sched_ScheduleOnce(schedHandle_t handle, uint32_t delayMS)
+{
+    Std_ReturnType error = E_OK;
+    if(handle >= SCHED_MAX_TASKS || SCHED_TASK_FREE == Sched_task[handle].state || SCHED_MS_TO_TICKS(delayMS) >= SCHED_MAX_TICKS ||
+       (SCHED_TASK_RUNNING == Sched_task[handle].state && !Sched_task[handle].oneShot))
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        Sched_task[handle].oneShot = 1;
+        Sched_Release(handle, (schedTicks_t)(SCHED_MS_TO_TICKS(delayMS) + 1));
+    }
+    return error;
+}
+
+/**
+ * @brief Gets the configuration of a task slot
+ * 
+ * @param handle The task slot
+ * @param info The configuration
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the slot is free
+ */
+Std_ReturnType Sched_GetTaskInfo(schedHandle_t handle, sysTaskInfo_t* info)
+{
+    Std_ReturnType error = E_NOT_OK;
+    if(handle < SCHED_MAX_TASKS && SCHED_TASK_FREE != Sched_task[handle].state)
+    {
+        *info = *Sched_task[handle].taskInfo;
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+#if SCHED_INSTRUMENTATION == STD_ON
+/**
+ * @brief Gets the execution time, release jitter and missed tick statistics of a task
+ * 
+ * @param task The task
+ * @param stats The statistics
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the task is not configured
+ */
+Std_ReturnType Sched_GetTaskStats(const task_t* task, schedTaskStats_t* stats)
+{
+    uint8_t i;
+    Std_ReturnType error = E_NOT_OK;
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(SCHED_TASK_FREE != Sched_task[i].state && Sched_task[i].taskInfo->task == task)
+        {
+            *stats = Sched_stats[i].stats;
+            stats->avgExecCounts = Sched_stats[i].execRuns ? (uint16_t)(Sched_stats[i].execSum / Sched_stats[i].execRuns) : 0;
+            error = E_OK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return error;
+}
+
+/**
+ * @brief Gets the number of compare matches that came while a previous one was still pending
+ * 
+ * @return uint16_t The number of ticks
+ */
+uint16_t Sched_GetLateTicks(void)
+{
+    return Sched_lateTicks;
+}
+#endif
+
+#if SCHED_WATCHDOG == STD_ON
+/**
+ * @brief Gets the cause of the last reset and the task that missed its deadline before a watchdog reset,
+ *          It is only available when SCHED_WATCHDOG is STD_ON
+ * 
+ * @param info The reset information
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Sched_GetResetInfo(schedResetInfo_t* info)
+{
+    *info = Sched_resetInfo;
+    return E_OK;
+}
+#endif
+
+#if SCHED_CPU_LOAD == STD_ON
+/**
+ * @brief Gets the CPU load, the peak busy time and the busy time histogram,
+ *          It is only available when SCHED_CPU_LOAD is STD_ON
+ * 
+ * @param load The CPU load
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the function is not executed correctly
+ */
+Std_ReturnType Sched_GetCpuLoad(schedCpuLoad_t* load)
+{
+    /* The Meter Is Updated By The Scheduler Loop, Not By The Interrupt */
+    *load = Sched_cpuLoad;
     return E_OK;
-}
\ No newline at end of file
+}
+#endif
+
+/**
+ * @brief Gets the number of ticks handled by the overload policy, the scans that caught up,
+ *        the skipped ticks or the scans that deferred the deferrable tasks
+ * 
+ * @return uint16_t The number of ticks
+ */
+uint16_t Sched_GetOverloadTicks(void)
+{
+    return Sched_overloadTicks;
+}
+
+#ifdef HW_HOST
+/**
+ * @brief Overrides the period of a task for this instance, it is applied by Sched_Init
+ * 
+ * @param task The task
+ * @param periodMS The period in milli seconds, 0 restores the configured period
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the task is not configured or the period does not fit SCHED_PERIOD_FITS
+ */
+Std_ReturnType Sched_SetPeriodOverride(const task_t* task, uint32_t periodMS)
+{
+    uint8_t i;
+    Std_ReturnType error = E_NOT_OK;
+    for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
+    {
+        if(Sched_sysTaskInfo[i].task == task && (0 == periodMS || SCHED_PERIOD_FITS(periodMS)))
+        {
+            Sched_periodOverrideMS[i] = periodMS;
+            error = E_OK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return error;
+}
+#endif
@@ -12,17 +12,53 @@
 #include "Std_Types.h"
 #include "Sched_Cfg.h"
 #include "Sched.h"
+#include "Switch_Cfg.h"
+#include "SSeg_Cfg.h"
+#include "AdcSeq_Cfg.h"
+#include "WaterHeater_Cfg.h"
+#include "Int.h"
+#include "Adc.h"
+#include "I2c.h"
 
 extern const task_t WaterHeater_InitTask;
 extern const task_t WaterHeater_Task;
 extern const task_t SSeg_task;
 extern const task_t Switch_task;
+extern const task_t AdcSeq_task;
 
-const sysTaskInfo_t Sched_sysTaskInfo[SCHED_NUMBER_OF_TASKS] = 
+/* A Supervised Task Must Complete A Run Within Its Deadline, It Covers Several Periods And The Overload Deferrals */
+#define SCHED_CFG_DEADLINE_MS             250
+
+/* The Periods And The Deadline Are Whole Numbers Of Ticks That Fit The Tick Counters */
+STD_STATIC_ASSERT(SCHED_PERIOD_FITS(WATER_HEATER_INIT_TASK_PERIODICITY), Sched_waterHeaterInitPeriodCheck);
+STD_STATIC_ASSERT(SCHED_PERIOD_FITS(SWITCH_TASK_PERIOD_MS), Sched_switchPeriodCheck);
+STD_STATIC_ASSERT(SCHED_PERIOD_FITS(WATER_HEATER_MAIN_TASK_PERIODICITY), Sched_waterHeaterPeriodCheck);
+STD_STATIC_ASSERT(SCHED_PERIOD_FITS(SSEG_TASK_PERIOD_MS), Sched_sSegPeriodCheck);
+STD_STATIC_ASSERT(SCHED_PERIOD_FITS(ADCSEQ_TASK_PERIOD_MS), Sched_adcSeqPeriodCheck);
+STD_STATIC_ASSERT(SCHED_PERIOD_FITS(SCHED_CFG_DEADLINE_MS), Sched_deadlineCheck);
+
+/* The Periods Must Be The Ones Of The Tasks, The Compiler Converts Them So Sched_Init Does Not Divide */
+/* The First Delays Spread The Tasks Over The Ticks Of Their Period, They Come From water_heater_offsets */
+const sysTaskInfo_t Sched_sysTaskInfo[] = 
 {
-    /* Task                        First Delay */
-    {&WaterHeater_InitTask,              0      },
-    {&Switch_task,                       1     },
-    {&WaterHeater_Task,                  1     },
-    {&SSeg_task,                         2     }
+    /* Task                        Period (Ticks)                                          First Delay      Overload Class           Priority    Context                Deadline (Ticks) */
+    {&WaterHeater_InitTask,        SCHED_MS_TO_TICKS(WATER_HEATER_INIT_TASK_PERIODICITY),        0,         SCHED_TASK_CRITICAL,        3,      SCHED_CONTEXT_TASK,    0                                       },
+    {&Switch_task,                 SCHED_MS_TO_TICKS(SWITCH_TASK_PERIOD_MS),                     1,         SCHED_TASK_CRITICAL,        2,      SCHED_CONTEXT_TASK,    SCHED_MS_TO_TICKS(SCHED_CFG_DEADLINE_MS) },
+    {&WaterHeater_Task,            SCHED_MS_TO_TICKS(WATER_HEATER_MAIN_TASK_PERIODICITY),        1,         SCHED_TASK_CRITICAL,        0,      SCHED_CONTEXT_TASK,    SCHED_MS_TO_TICKS(SCHED_CFG_DEADLINE_MS) },
+    {&SSeg_task,                   SCHED_MS_TO_TICKS(SSEG_TASK_PERIOD_MS),                       2,         SCHED_TASK_DEFERRABLE,      1,      SCHED_CONTEXT_TASK,    SCHED_MS_TO_TICKS(SCHED_CFG_DEADLINE_MS) },
+    {&AdcSeq_task,                 SCHED_MS_TO_TICKS(ADCSEQ_TASK_PERIOD_MS),                     4,         SCHED_TASK_CRITICAL,        2,      SCHED_CONTEXT_TASK,    SCHED_MS_TO_TICKS(SCHED_CFG_DEADLINE_MS) }
 };
+
+/* Every Configured Task Has One Entry */
+STD_STATIC_ASSERT(sizeof(Sched_sysTaskInfo) / sizeof(Sched_sysTaskInfo[0]) == SCHED_NUMBER_OF_TASKS, Sched_tableSizeCheck);
+
+#if SCHED_SLEEP == STD_ON
+/* SLEEP Stops A Conversion And A Bus Operation, The Core Only Sleeps While These Drivers Are Idle */
+const schedSleepCheck_t Sched_sleepChecks[] =
+{
+    Adc_CheckIdle,
+    I2c_CheckIdle
+};
+
+STD_STATIC_ASSERT(sizeof(Sched_sleepChecks) / sizeof(Sched_sleepChecks[0]) == SCHED_NUMBER_OF_SLEEP_CHECKS, Sched_sleepChecksSizeCheck);
+#endif
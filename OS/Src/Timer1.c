@@ -9,15 +9,16 @@
 #include "Std_Types.h"
 #include "Int.h"
 #include "Timer1.h"
+#include "Hw.h"
 /* Timer 1 Registers */
-#define TMR1                      *(uint16_t*)0x0E
-#define CCPR1                     *(uint16_t*)0x15
-#define TMR1_CON                  *(uint8_t*)0x10
+#define TMR1                      0x0E
+#define CCPR1                     0x15
+#define TMR1_CON                  0x10
 
-#define INT_CON                   *(uint8_t*)0x0B
-#define CCP1_CON                  *(uint8_t*)0x17
-#define PIE                       *(uint8_t*)0x8C
-#define PIF                       *(uint8_t*)0x0C
+#define INT_CON                   0x0B
+#define CCP1_CON                  0x17
+#define PIE                       0x8C
+#define PIF                       0x0C
 /* Timer 1 Masks */
 #define CCP1_INT_EN                          0x04
 #define CCP1_CON_CLR                         0xF0
@@ -31,6 +32,23 @@
 #define TMR1_DIS                             0xFE
 #define TMR1_CS_INTERNAL                     0xFD  
 #define TMR1_PRESCALER_CLR		             0xF8
+#define TMR1_OVF_INT_EN                      0x01
+#define TMR1_OVF_INT_DIS                     0xFE
+#define TMR1_OVF_FLAG                        0x01
+#define TMR1_OVF_FLAG_CLR                    0xFE
+#define TMR1_OSC_EN                          0x08
+/* The Crystal Oscillator, Not Synchronized So It Counts In Sleep, External Clock, Prescaler 1:1, On */
+#define TMR1_CRYSTAL                         0x0F
+/* The Interrupt Flags Of INTCON, Their Enables Are 3 Bits Above Them */
+#define INT_CON_FLAGS                        0x07
+
+/* The Polls For The First Edge Of The Crystal, More Than One Crystal Count */
+#define TMR1_OSC_POLLS                       64
+/* The Instruction Cycles Of One Poll */
+#define TMR1_POLL_CYCLES                     4
+/* The Instruction Cycles Timer 1 Counts Neither Clock While It Changes Them Besides The Polls, 9 Register Accesses
+ * Of 4 Cycles Like The Simulator Charges Them, The Listing Of The Target Build Must Agree */
+#define TMR1_SWITCH_CYCLES                   36
 
 /**
  * Function:  Timer1_InterruptEnable 
@@ -45,11 +63,11 @@
 Std_ReturnType Timer1_InterruptEnable(void)
 {
     /* Enable Global Interrupt */
-    INT_CON |= INT_EN;
+    HW_OR8(INT_CON, INT_EN);
     /* Enable Timer 1 Interrupt */
-    PIE |= CCP1_INT_EN;
-    CCP1_CON |= CCP1_CON_CLR;
-    CCP1_CON |= CCP1_CON_SP;
+    HW_OR8(PIE, CCP1_INT_EN);
+    HW_OR8(CCP1_CON, CCP1_CON_CLR);
+    HW_OR8(CCP1_CON, CCP1_CON_SP);
     return E_OK;
 }
 
@@ -66,7 +84,7 @@ Std_ReturnType Timer1_InterruptEnable(void)
 Std_ReturnType Timer1_InterruptDisable(void)
 {
     /* Disable Timer 1 Interrupt */
-    PIE &= CCP1_INT_DIS;
+    HW_AND8(PIE, CCP1_INT_DIS);
     return E_OK;
 }
 
@@ -87,15 +105,15 @@ Std_ReturnType Timer1_InterruptDisable(void)
 Std_ReturnType Timer1_Start(Timer1_Prescaler_t prescaler)
 {
     /* Disable Timer 1 */
-    TMR1_CON &= TMR1_DIS;
+    HW_AND8(TMR1_CON, TMR1_DIS);
     /* Clears The Prescaler */
-	TMR1_CON &= TMR1_PRESCALER_CLR & TMR1_CS_INTERNAL;
+	HW_AND8(TMR1_CON, TMR1_PRESCALER_CLR & TMR1_CS_INTERNAL);
     /* Sets The Prescaler */
-    TMR1_CON |= prescaler;
+    HW_OR8(TMR1_CON, prescaler);
     /* Clears The Timer Value */
-    TMR1 = 0;
+    HW_WRITE16(TMR1, 0);
     /* Enables The Timer */
-    TMR1_CON |= TMR1_EN;
+    HW_OR8(TMR1_CON, TMR1_EN);
     return E_OK;
 }
 
@@ -112,7 +130,7 @@ Std_ReturnType Timer1_Start(Timer1_Prescaler_t prescaler)
 Std_ReturnType Timer1_Stop(void)
 {
     /* Stops The Timer */
-    TMR1_CON &= TMR1_DIS;
+    HW_AND8(TMR1_CON, TMR1_DIS);
     return E_OK;
 }
 
@@ -129,8 +147,13 @@ Std_ReturnType Timer1_Stop(void)
  */
 Std_ReturnType Timer1_GetValue(uint16_t* val)
 {
-    /* Saves The Timer Value */
-    *val = TMR1;
+    uint8_t high;
+    /* Saves The Timer Value, Read Again If The Low Byte Rolled Over Between The Two Reads */
+    do
+    {
+        high = HW_READ8(TMR1 + 1);
+        *val = HW_READ16(TMR1);
+    } while(high != (uint8_t)(*val >> 8));
     return E_OK;
 }
 
@@ -162,7 +185,7 @@ Std_ReturnType Timer1_SetCallBack(interruptCb_t func)
  */
 Std_ReturnType Timer1_ClearValue(void)
 {
-    TMR1 = 0;
+    HW_WRITE16(TMR1, 0);
     return E_OK;
 }
 
@@ -171,19 +194,129 @@ Std_ReturnType Timer1_ClearValue(void)
  * --------------------
  *  @brief Sets The reload time for timer 1
  *
- *  @param timerClock: The Timer clock frequency
+ *  @param timerClock: The Timer clock frequency in Hz, a multiple of 1 KHz
  *  @param timeUS: The time in Micro seconds
  *  
  *  @returns: A status
  *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the time does not fit the 16-bit compare register
+ */
+Std_ReturnType Timer1_SetTimeUS(uint32_t timerClock, uint32_t timeUS)
+{
+    uint32_t countsPerMS = timerClock / 1000UL;
+    uint32_t val;
+    Std_ReturnType error = E_OK;
+    /* The Integer Math Keeps The Floating Point Library Out Of The Image */
+    if(countsPerMS && timeUS > 0xFFFFFFFFUL / countsPerMS)
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        /* Get The Value In Micro Seconds */
+        val = countsPerMS * timeUS / 1000UL;
+        if(val > 0xFFFFUL)
+        {
+            error = E_NOT_OK;
+        }
+        else
+        {
+            /* Instert The Value Into The Register */
+            HW_WRITE16(CCPR1, (uint16_t)val);
+        }
+    }
+	return error;
+}
+
+/**
+ * Function:  Timer1_SetCompare 
+ * --------------------
+ *  @brief Sets The compare value for timer 1 in timer counts, it avoids the division of Timer1_SetTimeUS
+ *
+ *  @param counts: The compare value in timer counts
+ *  
+ *  @returns: A status
+ *                 E_OK : if the function is executed correctly
  *                 E_NOT_OK : if the function is not executed correctly
  */
-Std_ReturnType Timer1_SetTimeUS(f64 timerClock, uint32_t timeUS)
+Std_ReturnType Timer1_SetCompare(uint16_t counts)
 {
-    f64 val;
-    /* Get The Value In Micro Seconds */
-    val = (f64)timerClock*(f64)timeUS/1000000.0;
     /* Instert The Value Into The Register */
-    CCPR1 = (uint16_t)val;
-	return E_OK;
+    HW_WRITE16(CCPR1, counts);
+    return E_OK;
+}
+
+/**
+ * Function:  Timer1_Sleep 
+ * --------------------
+ *  @brief Sleeps the core for a number of crystal counts, Timer 1 counts the 32.768 kHz crystal while the instruction
+ *         clock is stopped and wakes the core on its overflow, then it counts the instruction clock again from the
+ *         value it would have reached so the compare comes at its time. The global interrupt must be disabled and
+ *         no peripheral may be running on the instruction clock
+ *
+ *  @param counts: The crystal counts to sleep, the wake up and the wait for the first edge come on top of them
+ *  @param countCycles: The timer counts of one crystal count in 1/256
+ *  @param wakeCycles: The timer counts from the overflow until the core runs again, the oscillator start-up timer
+ *  
+ *  @returns: A status
+ *                 E_OK : if the core slept until the overflow
+ *                 E_NOT_OK : if an enabled interrupt is pending, the crystal does not count or something else woke the core
+ */
+Std_ReturnType Timer1_Sleep(uint16_t counts, uint16_t countCycles, uint16_t wakeCycles)
+{
+    Std_ReturnType error = E_NOT_OK;
+    uint8_t intCon = HW_READ8(INT_CON);
+    uint8_t control;
+    uint8_t start;
+    uint8_t polls = TMR1_OSC_POLLS;
+    uint16_t value;
+    /* SLEEP Does Not Stop The Clock While An Enabled Interrupt Is Pending */
+    if((HW_READ8(PIF) & HW_READ8(PIE)) || (intCon & (intCon >> 3) & INT_CON_FLAGS))
+    {
+        /* The Interrupt Is Served First */
+    }
+    else
+    {
+        /* The Oscillator Is Left Running So The Crystal Has Started By The Next Sleep */
+        control = HW_READ8(TMR1_CON) | TMR1_OSC_EN;
+        HW_AND8(PIF, TMR1_OVF_FLAG_CLR);
+        HW_OR8(PIE, TMR1_OVF_INT_EN);
+        /* Timer 1 Stops On The Instruction Clock And Counts The Crystal Up To The Overflow */
+        HW_WRITE8(TMR1_CON, control & TMR1_DIS);
+        value = HW_READ16(TMR1);
+        start = (uint8_t)(0U - counts);
+        HW_WRITE16(TMR1, (uint16_t)(0U - counts));
+        HW_WRITE8(TMR1_CON, TMR1_CRYSTAL);
+        while(polls && HW_READ8(TMR1) == start)
+        {
+            polls--;
+        }
+        /* The Polls Measure The Phase Of The Crystal */
+        value += TMR1_SWITCH_CYCLES + (uint16_t)(TMR1_OSC_POLLS - polls) * TMR1_POLL_CYCLES;
+        if(polls)
+        {
+            /* The First Edge Came Half A Poll Before It Was Seen, Then The Rest Of The Counts And The Wake Up */
+            value += (TMR1_POLL_CYCLES / 2) + (uint16_t)(((uint32_t)(counts - 1U) * countCycles + 128U) >> 8) + wakeCycles;
+            HW_SLEEP();
+        }
+        else
+        {
+            /* The Crystal Has Not Started, The Core Stays Awake */
+        }
+        /* Back On The Instruction Clock */
+        HW_WRITE8(TMR1_CON, control & TMR1_DIS);
+        HW_WRITE16(TMR1, value);
+        HW_WRITE8(TMR1_CON, control);
+        if(polls && (HW_READ8(PIF) & TMR1_OVF_FLAG))
+        {
+            error = E_OK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        HW_AND8(PIE, TMR1_OVF_INT_DIS);
+        HW_AND8(PIF, TMR1_OVF_FLAG_CLR);
+    }
+    return error;
 }
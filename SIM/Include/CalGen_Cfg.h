@@ -0,0 +1,46 @@
+/**
+ * @file CalGen_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The configurations of the generator of the sensor linearization tables
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef CALGEN_CFG_H_
+#define CALGEN_CFG_H_
+
+/* A Table Has A Point Every 2^n Counts Of The Oversampled Samples, The Interpolation Shifts By n */
+#define CALGEN_SEGMENT_BITS               6
+
+/* The Reference Of The ADC, The Dividers Are Supplied From It */
+#define CALGEN_VREF_MV                    5000.0
+
+/* The Temperatures Beyond The Range Are Clamped, An Open Or A Shorted Sensor Reads At One End */
+#define CALGEN_MIN_C                      -40.0
+#define CALGEN_MAX_C                      150.0
+
+/* The Range Of The Water Where The Interpolation Error Is Checked */
+#define CALGEN_CHECK_MIN_C                0.0
+#define CALGEN_CHECK_MAX_C                100.0
+
+/* LM35, The Output Goes Straight To The ADC */
+#define CALGEN_LM35_MV_PER_C              10.0
+
+/* 10k NTC To Ground With A Series Resistor To The Reference */
+#define CALGEN_NTC_SERIES_OHM             10000.0
+#define CALGEN_NTC_R25_OHM                10000.0
+#define CALGEN_NTC_BETA_K                 3950.0
+/* The Steinhart-Hart Coefficients Of The Same Part, 1/T = A + B ln(R) + C ln(R)^3 */
+#define CALGEN_NTC_SH_A                   1.009249522e-3
+#define CALGEN_NTC_SH_B                   2.378405444e-4
+#define CALGEN_NTC_SH_C                   2.019202697e-7
+
+/* PT1000 To Ground With A Series Resistor To The Reference, Callendar-Van Dusen Above 0 C */
+#define CALGEN_PT1000_SERIES_OHM          1000.0
+#define CALGEN_PT1000_R0_OHM              1000.0
+#define CALGEN_PT1000_A                   3.9083e-3
+#define CALGEN_PT1000_B                   -5.775e-7
+
+#endif
@@ -0,0 +1,136 @@
+/**
+ * @file HwSim.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The user interface for the host simulation of the PIC16F877A peripherals
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef HW_SIM_H_
+#define HW_SIM_H_
+
+typedef void (*HwSim_Hook_t)(void);
+typedef uint16_t (*HwSim_AdcSource_t)(uint8_t channel);
+
+/* The Simulated Ports, Same Addresses As GPIO_PORTx */
+#define HW_SIM_PORTA                    0x05
+#define HW_SIM_PORTB                    0x06
+#define HW_SIM_PORTC                    0x07
+#define HW_SIM_PORTD                    0x08
+#define HW_SIM_PORTE                    0x09
+
+/**
+ * @brief Puts the register file, the peripherals and the EEPROM in their power on state
+ * 
+ */
+extern void HwSim_Reset(void);
+
+/**
+ * @brief Sets the simulated run time, the stop handler is called when it elapses
+ * 
+ * @param cycles The run time in instruction cycles
+ */
+extern void HwSim_SetRunTime(uint64_t cycles);
+
+/**
+ * @brief Gets the simulated time since reset
+ * 
+ * @return uint64_t The time in instruction cycles
+ */
+extern uint64_t HwSim_GetCycles(void);
+
+/**
+ * @brief Gets the time the firmware spent waiting in HW_IDLE or HW_SLEEP
+ * 
+ * @return uint64_t The time in instruction cycles
+ */
+extern uint64_t HwSim_GetIdleCycles(void);
+
+/**
+ * @brief Gets the time the instruction clock was stopped by HW_SLEEP
+ * 
+ * @return uint64_t The time in instruction cycles
+ */
+extern uint64_t HwSim_GetSleepCycles(void);
+
+/**
+ * @brief Gets the number of CCP1 compare matches, every match wakes the firmware up
+ * 
+ * @return uint64_t The number of compare matches
+ */
+extern uint64_t HwSim_GetCompareMatches(void);
+
+/**
+ * @brief Gets the longest time between two clears of the watchdog, the time since the last clear included
+ * 
+ * @return uint64_t The time in instruction cycles
+ */
+extern uint64_t HwSim_GetLongestWatchdogGap(void);
+
+/**
+ * @brief Gets the number of watchdog clears that came after the watchdog period, the target would have reset
+ * 
+ * @return uint32_t The number of time outs
+ */
+extern uint32_t HwSim_GetWatchdogTimeouts(void);
+
+/**
+ * @brief Sets the handler that is called when the run time elapses, it must not return
+ *          The default handler prints a summary and exits the process
+ * 
+ * @param hook The handler
+ */
+extern void HwSim_SetStopHandler(HwSim_Hook_t hook);
+
+/**
+ * @brief Sets a hook that is called on every CCP1 compare event
+ * 
+ * @param hook The hook
+ */
+extern void HwSim_SetTickHook(HwSim_Hook_t hook);
+
+/**
+ * @brief Sets the source of the analog inputs
+ * 
+ * @param source Returns a 10-bit sample for a channel
+ */
+extern void HwSim_SetAdcSource(HwSim_AdcSource_t source);
+
+/**
+ * @brief Drives the external level of input pins
+ * 
+ * @param port The port
+ *          @arg HW_SIM_PORTx
+ * @param pins The pins mask
+ * @param level The level (0/1)
+ */
+extern void HwSim_SetPins(uint8_t port, uint8_t pins, uint8_t level);
+
+/**
+ * @brief Gets the pins that are configured as outputs and driven high
+ * 
+ * @param port The port
+ *          @arg HW_SIM_PORTx
+ * @return uint8_t The pins mask
+ */
+extern uint8_t HwSim_GetOutputs(uint8_t port);
+
+/**
+ * @brief Reads a byte from the simulated EEPROM without using the bus
+ * 
+ * @param address The EEPROM address
+ * @return uint8_t The data
+ */
+extern uint8_t HwSim_GetEepromByte(uint16_t address);
+
+/**
+ * @brief Makes the EEPROM refuse the next page writes, it does not acknowledge their first data byte
+ *        and nothing is written, like a device that is still busy or failing
+ * 
+ * @param writes The number of page writes to refuse
+ */
+extern void HwSim_SetEepromWriteFaults(uint32_t writes);
+
+#endif
@@ -0,0 +1,43 @@
+/**
+ * @file HwSim_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The configurations for the host simulation of the PIC16F877A peripherals
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef HW_SIM_CFG_H_
+#define HW_SIM_CFG_H_
+
+/* The Instruction Clock Of The Simulated Part (8 MHz Crystal / 4) */
+#define HW_SIM_CYCLES_PER_SECOND              2000000ULL
+
+/* The Timer 1 Crystal On RC0/RC1 And Its Start-Up Time In Instruction Cycles (200 mS) */
+#define HW_SIM_T1OSC_CLK                      32768ULL
+#define HW_SIM_T1OSC_START_CYCLES             400000
+
+/* The Oscillator Start-Up Timer After A Wake Up From Sleep In Instruction Cycles (1024 Crystal Periods) */
+#define HW_SIM_OST_CYCLES                     256
+
+/* The Cost In Instruction Cycles Charged For Every Register Access */
+#define HW_SIM_ACCESS_CYCLES                  4
+
+/* The Conversion Time Of The ADC In Instruction Cycles (20 uS) */
+#define HW_SIM_ADC_CONVERSION_CYCLES          40
+
+/* The External 24Cxx EEPROM */
+#define HW_SIM_EEPROM_SIZE                    32768
+#define HW_SIM_EEPROM_PAGE_SIZE               64
+#define HW_SIM_EEPROM_DEVICE_ADDRESS          0xA0
+/* The Internal Write Cycle Of The EEPROM (5 mS) */
+#define HW_SIM_EEPROM_WRITE_CYCLES            10000
+
+/* The Nominal Watchdog Period Without The Prescaler In Instruction Cycles (18 mS) */
+#define HW_SIM_WDT_PERIOD_CYCLES              36000
+
+/* The Default Simulated Run Time In Seconds */
+#define HW_SIM_DEFAULT_RUN_TIME_S             60
+
+#endif
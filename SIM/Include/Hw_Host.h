@@ -0,0 +1,134 @@
+/**
+ * @file Hw_Host.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The host register backend for the hardware access layer, the registers live in a simulated register file
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef HW_HOST_H_
+#define HW_HOST_H_
+#include "HwSim_Cfg.h"
+
+/* The Size Of The Data Memory (4 Banks) */
+#define HW_REG_FILE_SIZE                0x200
+
+/* Every Access Goes Through The Simulator So The Peripheral Models Can React */
+#define HW_READ8(address)               Hw_Read8((uint16_t)(address))
+#define HW_WRITE8(address, value)       Hw_Write8((uint16_t)(address), (uint8_t)(value))
+#define HW_OR8(address, mask)           Hw_Write8((uint16_t)(address), (uint8_t)(Hw_Read8((uint16_t)(address)) | (uint8_t)(mask)))
+#define HW_AND8(address, mask)          Hw_Write8((uint16_t)(address), (uint8_t)(Hw_Read8((uint16_t)(address)) & (uint8_t)(mask)))
+
+/* The Interrupt Service Routine Is Called Directly By The Simulator */
+#define HW_INTERRUPT
+
+/* Lets The Simulated Time Jump To The Next Peripheral Event */
+#define HW_IDLE()                       Hw_Idle()
+
+/* The Simulated Time Jumps To The Interrupt That Wakes The Core */
+#define HW_SLEEP()                      Hw_Sleep()
+
+/* Every Host Thread Runs Its Own Instance Of The Firmware And The Simulated Hardware */
+#define HW_INSTANCE                     _Thread_local
+
+/* The Simulator Never Resets The Firmware, The Persistent Variables Are Plain Instance Variables */
+#define HW_PERSISTENT                   HW_INSTANCE
+
+/* The Simulator Measures The Time Between The Clears Of The Watchdog */
+#define HW_CLEAR_WATCHDOG()             Hw_ClearWatchdog()
+
+typedef struct
+{
+    /* The Simulated Time In Instruction Cycles */
+    uint64_t cycles;
+    /* The Plain Register File Path Is Only Taken Before This Cycle,
+     * It Is Pulled In By Pending Peripheral Events And Interrupts */
+    uint64_t deadline;
+    uint8_t reg[HW_REG_FILE_SIZE];
+} hwCore_t;
+
+/* The Simulated Register File */
+extern HW_INSTANCE hwCore_t Hw_core;
+/* The Registers That Have A Peripheral Model Behind Them */
+extern const uint8_t Hw_modelRead[HW_REG_FILE_SIZE];
+extern const uint8_t Hw_modelWrite[HW_REG_FILE_SIZE];
+
+/**
+ * @brief Reads a register that has a peripheral model or when an event is due
+ * 
+ * @param address The data memory address of the register
+ * @return uint8_t The register value
+ */
+extern uint8_t Hw_ModelRead8(uint16_t address);
+
+/**
+ * @brief Writes a register that has a peripheral model or when an event is due
+ * 
+ * @param address The data memory address of the register
+ * @param value The value to write
+ */
+extern void Hw_ModelWrite8(uint16_t address, uint8_t value);
+
+/**
+ * @brief Advances the simulated time to the next peripheral event
+ * 
+ */
+extern void Hw_Idle(void);
+
+/**
+ * @brief Stops the simulated instruction clock until an enabled interrupt flag is set
+ * 
+ */
+extern void Hw_Sleep(void);
+
+/**
+ * @brief Clears the simulated watchdog timer
+ * 
+ */
+extern void Hw_ClearWatchdog(void);
+
+/**
+ * @brief Reads a register from the simulated register file
+ * 
+ * @param address The data memory address of the register
+ * @return uint8_t The register value
+ */
+static inline uint8_t Hw_Read8(uint16_t address)
+{
+    uint8_t value;
+    address &= (HW_REG_FILE_SIZE - 1);
+    Hw_core.cycles += HW_SIM_ACCESS_CYCLES;
+    if(Hw_core.cycles < Hw_core.deadline && !Hw_modelRead[address])
+    {
+        value = Hw_core.reg[address];
+    }
+    else
+    {
+        value = Hw_ModelRead8(address);
+    }
+    return value;
+}
+
+/**
+ * @brief Writes a register in the simulated register file
+ * 
+ * @param address The data memory address of the register
+ * @param value The value to write
+ */
+static inline void Hw_Write8(uint16_t address, uint8_t value)
+{
+    address &= (HW_REG_FILE_SIZE - 1);
+    Hw_core.cycles += HW_SIM_ACCESS_CYCLES;
+    if(Hw_core.cycles < Hw_core.deadline && !Hw_modelWrite[address])
+    {
+        Hw_core.reg[address] = value;
+    }
+    else
+    {
+        Hw_ModelWrite8(address, value);
+    }
+}
+
+#endif
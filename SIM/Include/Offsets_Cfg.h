@@ -0,0 +1,30 @@
+/**
+ * @file Offsets_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The configurations of the first delay planner of the scheduler tasks
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef OFFSETS_CFG_H_
+#define OFFSETS_CFG_H_
+
+/* The Simulated Run That Measures The Execution Times, It Covers The Button Presses And The Setpoint Save */
+#define OFFSETS_DEFAULT_RUN_TIME_S        3600.0
+
+/* The Setpoint Of The Run And The Time The Heater Is Switched Off And On */
+#define OFFSETS_SETPOINT_C                65
+#define OFFSETS_RESTART_S                 600.0
+
+/* The Margin Added To The Longest Measured Execution Time */
+#define OFFSETS_DEFAULT_MARGIN_PERCENT    20.0
+
+/* The Longest Hyperperiod That Is Planned, The Profile Has One Entry Per Tick */
+#define OFFSETS_MAX_HYPERPERIOD_TICKS     10000UL
+
+/* The Passes That Move One Task At A Time After The First Placement */
+#define OFFSETS_MAX_PASSES                100
+
+#endif
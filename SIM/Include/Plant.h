@@ -0,0 +1,90 @@
+/**
+ * @file Plant.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The user interface for the simulated water tank
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef PLANT_H_
+#define PLANT_H_
+#include "Plant_Cfg.h"
+
+typedef struct
+{
+    f64 startS;
+    f64 durationS;
+    f64 litresPerMin;
+} plantDraw_t;
+
+typedef struct
+{
+    f64 volumeL;
+    f64 heaterW;
+    f64 coolerW;
+    f64 lossWPerK;
+    f64 ambientC;
+    f64 inletC;
+    f64 initialC;
+    f64 countsPerC;
+    f64 noiseCounts;
+    /* The Spike Of The Tank Sensor After An Element Switched And How Long It Lasts */
+    f64 glitchCounts;
+    f64 glitchS;
+    /* The Daily Draw-Off Profile, Times Are Seconds After Midnight */
+    uint8_t numberOfDraws;
+    plantDraw_t draws[PLANT_MAX_DRAWS];
+    uint32_t seed;
+} plantParams_t;
+
+typedef struct
+{
+    f64 temperatureC;
+    f64 heaterJ;
+    f64 coolerJ;
+    f64 drawnL;
+    f64 heaterOnS;
+    f64 coolerOnS;
+    uint32_t heaterSwitches;
+    uint32_t coolerSwitches;
+} plantState_t;
+
+/**
+ * @brief Fills the parameters with the default tank and draw-off profile
+ * 
+ * @param params The parameters
+ */
+extern void Plant_GetDefaults(plantParams_t* params);
+
+/**
+ * @brief Attaches the tank to the simulator, the ADC reads the tank and the elements heat it
+ *        The owner of the CCP1 tick hook calls Plant_Tick on every tick
+ * 
+ * @param params The parameters, they must stay valid while the simulation runs
+ */
+extern void Plant_Init(const plantParams_t* params);
+
+/**
+ * @brief Advances the tank to the current simulated time
+ * 
+ */
+extern void Plant_Step(void);
+
+/**
+ * @brief Called on every CCP1 tick, the tank is only integrated when an element switched
+ *        or PLANT_STEP_TICKS passed since the tank thermal time constant is hours long
+ * 
+ * @return uint8_t 1 if the tank was stepped
+ */
+extern uint8_t Plant_Tick(void);
+
+/**
+ * @brief Gets the tank state
+ * 
+ * @return const plantState_t* The state
+ */
+extern const plantState_t* Plant_GetState(void);
+
+#endif
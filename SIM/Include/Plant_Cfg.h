@@ -0,0 +1,45 @@
+/**
+ * @file Plant_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The configurations of the simulated water tank
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef PLANT_CFG_H_
+#define PLANT_CFG_H_
+
+/* The Element Pins, They Must Match Element_Cfg.c */
+#define PLANT_HEATER_PORT                 HW_SIM_PORTC
+#define PLANT_HEATER_PIN                  0x20
+#define PLANT_COOLER_PORT                 HW_SIM_PORTC
+#define PLANT_COOLER_PIN                  0x04
+
+/* The Temperature Sensor Channel, It Must Match The Channel Selected By The Application */
+#define PLANT_SENSOR_CHANNEL              2
+
+/* The Default Tank */
+#define PLANT_DEFAULT_VOLUME_L            50.0
+#define PLANT_DEFAULT_HEATER_W            2000.0
+#define PLANT_DEFAULT_COOLER_W            600.0
+#define PLANT_DEFAULT_LOSS_W_PER_K        2.5
+#define PLANT_DEFAULT_AMBIENT_C           22.0
+#define PLANT_DEFAULT_INLET_C             15.0
+#define PLANT_DEFAULT_INITIAL_C           22.0
+/* LM35 (10 mV/C) On A 10-Bit ADC With A 5 V Reference */
+#define PLANT_DEFAULT_COUNTS_PER_C        2.048
+#define PLANT_DEFAULT_NOISE_COUNTS        1.0
+/* The Element Switching Couples Into The Sensor Line, The Tank Sensor Reads This Many Counts More
+ * For A While After Every Switch, It Is Off By Default */
+#define PLANT_DEFAULT_GLITCH_COUNTS       0.0
+#define PLANT_DEFAULT_GLITCH_S            0.2
+
+/* The Tank Is Integrated At Least Every PLANT_STEP_TICKS CCP1 Ticks */
+#define PLANT_STEP_TICKS                  20
+
+/* The Maximum Number Of Draw-Off Events Per Day */
+#define PLANT_MAX_DRAWS                   8
+
+#endif
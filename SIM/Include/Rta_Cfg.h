@@ -0,0 +1,27 @@
+/**
+ * @file Rta_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The configurations of the worst case response time analysis of the scheduler tasks
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef RTA_CFG_H_
+#define RTA_CFG_H_
+
+/* The Simulated Run That Measures The Execution Times, It Covers The Button Presses And The Setpoint Save */
+#define RTA_DEFAULT_RUN_TIME_S            3600.0
+
+/* The Setpoint Of The Run And The Time The Heater Is Switched Off And On */
+#define RTA_SETPOINT_C                    65
+#define RTA_RESTART_S                     600.0
+
+/* The Margin Added To The Longest Measured Execution Time */
+#define RTA_DEFAULT_MARGIN_PERCENT        20.0
+
+/* The Iterations Of The Response Time Equation Before The Task Is Reported As Not Converging */
+#define RTA_MAX_ITERATIONS                1000
+
+#endif
@@ -0,0 +1,114 @@
+/**
+ * @file Sim.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The user interface for the closed loop simulation of the firmware and the water tank
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef SIM_H_
+#define SIM_H_
+#include "Sim_Cfg.h"
+#include "HwSim.h"
+#include "Plant.h"
+#include "Sched.h"
+#include "WaterHeater.h"
+
+typedef struct
+{
+    f64 runTimeS;
+    uint8_t setpointC;
+    f64 bandC;
+    plantParams_t plant;
+    /* The Setpoint Is Stepped By tuning.changeRate */
+    waterHeaterTuning_t tuning;
+    /* The Task Periods, 0 Keeps The Configured Period */
+    uint32_t mainTaskPeriodMS;
+    uint32_t switchTaskPeriodMS;
+    /* The Heater Is Switched Off And On Again At This Time, 0 Keeps It On */
+    f64 restartAtS;
+    /* The Page Writes Refused By The EEPROM, The Settings Have To Write Their Record Again */
+    uint32_t eepromWriteFaults;
+} simScenario_t;
+
+typedef struct
+{
+    f64 simulatedS;
+    f64 heaterKWh;
+    f64 coolerKWh;
+    f64 finalC;
+    f64 minC;
+    f64 maxC;
+    /* The Highest Temperature Above The Setpoint Once Scoring Started */
+    f64 overshootC;
+    /* The Time Spent Outside The Band Once Scoring Started */
+    f64 outsideBandS;
+    /* Scoring Starts When The Tank First Reaches The Band Or After SIM_WARM_UP_S */
+    f64 settleS;
+    f64 drawnL;
+    uint32_t heaterSwitches;
+    uint32_t coolerSwitches;
+    /* The Share Of The Time The Firmware Spent Waiting In HW_IDLE Or HW_SLEEP And The Share Asleep */
+    f64 idlePercent;
+    f64 sleepPercent;
+    uint64_t wakeUps;
+    /* The Longest Time Between Two Watchdog Clears And The Clears That Came Too Late */
+    f64 watchdogGapMS;
+    uint32_t watchdogTimeouts;
+} simResult_t;
+
+/**
+ * @brief Fills a scenario with the defaults
+ * 
+ * @param scenario The scenario
+ */
+extern void Sim_GetDefaults(simScenario_t* scenario);
+
+/**
+ * @brief Builds the default scenario from the command line and starts it, the results are printed at the end
+ *          -t <seconds> : The simulated run time
+ *          -d <days>    : The simulated run time in days
+ *          -s <celsius> : The setpoint entered with the buttons
+ *          -i <celsius> : The initial tank temperature
+ *          -r <celsius> : The change rate of the application
+ *          -n <count>   : The number of readings averaged by the application
+ *          -c <0|1>     : The temprature control feature
+ *          -p <ms>      : The period of the application task
+ *          -e <count>   : The page writes refused by the EEPROM, the run fails if the setpoint is not saved
+ * 
+ * @param argc The number of arguments
+ * @param argv The arguments
+ */
+extern void Sim_Init(int argc, char* argv[]);
+
+/**
+ * @brief Resets the simulator, attaches the tank and schedules the button presses of a scenario
+ * 
+ * @param scenario The scenario, it must stay valid while the simulation runs
+ * @param stop The handler called when the run time elapses, it must not return
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the tuning or the task periods are not valid
+ */
+extern Std_ReturnType Sim_Start(const simScenario_t* scenario, HwSim_Hook_t stop);
+
+/**
+ * @brief Gets the results of the running scenario
+ * 
+ * @param result The results
+ */
+extern void Sim_GetResult(simResult_t* result);
+
+#if SCHED_INSTRUMENTATION == STD_ON
+/**
+ * @brief Gets the name of a task of Sched_Cfg.c
+ * 
+ * @param task The task
+ * @return const char* The name, "?" if the task is not known
+ */
+extern const char* Sim_GetTaskName(const task_t* task);
+#endif
+
+#endif
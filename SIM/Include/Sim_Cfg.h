@@ -0,0 +1,39 @@
+/**
+ * @file Sim_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The configurations of the closed loop simulation scenarios
+ * @version 0.1
+ * @date 2020-07-05
+ * 
+ * @copyright Copyright (c) 2020
+ * 
+ */
+#ifndef SIM_CFG_H_
+#define SIM_CFG_H_
+
+/* The Buttons, They Must Match Switch_Cfg.c */
+#define SIM_BUTTON_PORT                   HW_SIM_PORTB
+#define SIM_ON_OFF_BUTTON                 0x20
+#define SIM_DOWN_BUTTON                   0x10
+#define SIM_UP_BUTTON                     0x08
+
+/* The Setpoint The Application Starts With */
+#define SIM_INITIAL_SETPOINT_C            60
+
+/* The Button Timing */
+#define SIM_POWER_ON_PRESS_S              1.0
+#define SIM_PRESS_S                       0.2
+#define SIM_PRESS_PERIOD_S                0.5
+#define SIM_MAX_PRESSES                   16
+
+/* The Band Used To Score The Temperature Control */
+#define SIM_DEFAULT_BAND_C                3.0
+/* The Band Is Scored From The First Time The Tank Reaches It Or After The Warm Up */
+#define SIM_WARM_UP_S                     7200.0
+
+/* The Run Fails When The Elements Switch More Often Than This, A Chattering Relay Shows Up As Thousands Of
+ * Switches A Day, The Allowance Covers The Warm Up Of A Short Run */
+#define SIM_MAX_SWITCHES_PER_DAY          500.0
+#define SIM_SWITCHES_ALLOWANCE            4.0
+
+#endif
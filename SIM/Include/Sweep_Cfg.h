@@ -0,0 +1,30 @@
+/**
+ * @file Sweep_Cfg.h
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The configurations of the parameter sweep of the closed loop simulation
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#ifndef SWEEP_CFG_H_
+#define SWEEP_CFG_H_
+
+/* The Simulated Usage Of Every Instance */
+#define SWEEP_DEFAULT_DAYS                7.0
+
+/* The Default Grid, Every Combination Is One Instance */
+#define SWEEP_DEFAULT_CHANGE_RATES        "2,3,5"
+#define SWEEP_DEFAULT_READINGS            "4,10,32"
+#define SWEEP_DEFAULT_PERIODS_MS          "25,50"
+#define SWEEP_DEFAULT_FEATURES            "0,1"
+
+/* The Limits Of The Grid And The Pool */
+#define SWEEP_MAX_VALUES                  16
+#define SWEEP_MAX_WORKERS                 64
+
+/* Lines Of The Ranked Report, 0 Prints Every Instance */
+#define SWEEP_DEFAULT_TOP                 20
+
+#endif
@@ -0,0 +1,302 @@
+/**
+ * @file CalGen.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The generator of the sensor linearization tables, every sensor curve of CalGen_Cfg.h is sampled
+ *        every 2^CALGEN_SEGMENT_BITS counts of the oversampled samples and written in tenths of a degree as
+ *        a const table, so the target only interpolates between two points with integer math
+ *
+ *        The tables and their header are written into the firmware tree and the largest interpolation
+ *        error against the exact curve is printed for every table
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Std_Types.h"
+#include "Int.h"
+#include "Adc.h"
+#include "AdcSeq.h"
+#include "CalGen_Cfg.h"
+
+#define CALGEN_KELVIN                     273.15
+#define CALGEN_R25_KELVIN                 (25.0 + CALGEN_KELVIN)
+#define CALGEN_TENTHS_PER_C               10.0
+
+/* The Tables Cover The Whole Range Of The Samples */
+#define CALGEN_INPUT_BITS                 ADCSEQ_RESOLUTION_BITS
+#define CALGEN_COUNTS                     (1UL << CALGEN_INPUT_BITS)
+#define CALGEN_POINTS                     ((CALGEN_COUNTS >> CALGEN_SEGMENT_BITS) + 1)
+
+#define CALGEN_DEFAULT_SOURCE             "ECUAL/Src/Cal_Tables.c"
+#define CALGEN_DEFAULT_HEADER             "ECUAL/Include/Cal_Tables.h"
+
+STD_STATIC_ASSERT(CALGEN_SEGMENT_BITS >= 1 && CALGEN_SEGMENT_BITS < CALGEN_INPUT_BITS, CalGen_segmentCheck);
+
+typedef struct
+{
+    const char* name;
+    const char* description;
+    /* The Temperature In C At A Ratio Of The Input To The Reference */
+    f64 (*model)(f64 ratio);
+} calGenCurve_t;
+
+/**
+ * @brief Limits a temperature to the range of the tables
+ *
+ */
+static f64 CalGen_Clamp(f64 temperatureC)
+{
+    f64 clamped = temperatureC;
+    if(temperatureC != temperatureC || temperatureC > CALGEN_MAX_C)
+    {
+        clamped = CALGEN_MAX_C;
+    }
+    else if(temperatureC < CALGEN_MIN_C)
+    {
+        clamped = CALGEN_MIN_C;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return clamped;
+}
+
+/**
+ * @brief The resistance of the lower leg of a divider at a ratio of the input to the reference
+ *
+ * @return f64 The resistance, 0 or less when shorted and infinite when open
+ */
+static f64 CalGen_LowerLeg(f64 ratio, f64 seriesOhm)
+{
+    return (ratio >= 1.0) ? INFINITY : seriesOhm * ratio / (1.0 - ratio);
+}
+
+/**
+ * @brief LM35, 10 mV per degree from 0 C
+ *
+ */
+static f64 CalGen_Lm35(f64 ratio)
+{
+    return CalGen_Clamp(ratio * CALGEN_VREF_MV / CALGEN_LM35_MV_PER_C);
+}
+
+/**
+ * @brief NTC with the beta equation, 1/T = 1/T25 + ln(R/R25)/beta
+ *
+ */
+static f64 CalGen_NtcBeta(f64 ratio)
+{
+    f64 ohm = CalGen_LowerLeg(ratio, CALGEN_NTC_SERIES_OHM);
+    f64 temperatureC = CALGEN_MAX_C;
+    if(ohm > 0.0)
+    {
+        temperatureC = 1.0 / (1.0 / CALGEN_R25_KELVIN + log(ohm / CALGEN_NTC_R25_OHM) / CALGEN_NTC_BETA_K) - CALGEN_KELVIN;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return CalGen_Clamp(temperatureC);
+}
+
+/**
+ * @brief NTC with the Steinhart-Hart equation, 1/T = A + B ln(R) + C ln(R)^3
+ *
+ */
+static f64 CalGen_NtcSteinhartHart(f64 ratio)
+{
+    f64 ohm = CalGen_LowerLeg(ratio, CALGEN_NTC_SERIES_OHM);
+    f64 logOhm;
+    f64 temperatureC = CALGEN_MAX_C;
+    if(ohm > 0.0)
+    {
+        logOhm = log(ohm);
+        temperatureC = 1.0 / (CALGEN_NTC_SH_A + CALGEN_NTC_SH_B * logOhm + CALGEN_NTC_SH_C * logOhm * logOhm * logOhm) - CALGEN_KELVIN;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return CalGen_Clamp(temperatureC);
+}
+
+/**
+ * @brief PT1000 with the Callendar-Van Dusen equation R = R0 (1 + A T + B T^2) solved for T,
+ *        the C term below 0 C is left out, it is under 0.1 C down to -40 C
+ *
+ */
+static f64 CalGen_Pt1000(f64 ratio)
+{
+    f64 ohm = CalGen_LowerLeg(ratio, CALGEN_PT1000_SERIES_OHM);
+    f64 discriminant = CALGEN_PT1000_A * CALGEN_PT1000_A - 4.0 * CALGEN_PT1000_B * (1.0 - ohm / CALGEN_PT1000_R0_OHM);
+    f64 temperatureC = CALGEN_MAX_C;
+    if(discriminant >= 0.0)
+    {
+        temperatureC = (-CALGEN_PT1000_A + sqrt(discriminant)) / (2.0 * CALGEN_PT1000_B);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return CalGen_Clamp(temperatureC);
+}
+
+static const calGenCurve_t CalGen_curves[] = {
+    {"Cal_lm35Table", "LM35, 10 mV/C", CalGen_Lm35},
+    {"Cal_ntcBetaTable", "10k NTC, beta 3950 K, 10k series resistor", CalGen_NtcBeta},
+    {"Cal_ntcSteinhartHartTable", "10k NTC, Steinhart-Hart, 10k series resistor", CalGen_NtcSteinhartHart},
+    {"Cal_pt1000Table", "PT1000, Callendar-Van Dusen, 1k series resistor", CalGen_Pt1000}
+};
+
+#define CALGEN_NUMBER_OF_CURVES           (sizeof(CalGen_curves) / sizeof(CalGen_curves[0]))
+
+/**
+ * @brief Samples a curve at the points of a table in tenths of a degree
+ *
+ */
+static void CalGen_Sample(const calGenCurve_t* curve, long* table)
+{
+    uint32_t i;
+    for(i=0; i<CALGEN_POINTS; i++)
+    {
+        table[i] = lround(curve->model((f64)(i << CALGEN_SEGMENT_BITS) / (f64)CALGEN_COUNTS) * CALGEN_TENTHS_PER_C);
+    }
+}
+
+/**
+ * @brief Gets the largest error of the interpolated table against the curve over the samples
+ *        in the checked range, the interpolation is the same as the one of Cal.c
+ *
+ * @return f64 The error in C
+ */
+static f64 CalGen_MaxError(const calGenCurve_t* curve, const long* table)
+{
+    f64 maxError = 0.0;
+    f64 error;
+    f64 exactC;
+    long tenths;
+    long product;
+    uint32_t counts;
+    uint32_t index;
+    uint32_t fraction;
+    for(counts=0; counts<CALGEN_COUNTS; counts++)
+    {
+        index = counts >> CALGEN_SEGMENT_BITS;
+        fraction = counts & ((1UL << CALGEN_SEGMENT_BITS) - 1);
+        /* Rounded To The Nearest With The Halves Away From Zero */
+        product = (table[index + 1] - table[index]) * (long)fraction;
+        tenths = table[index] + ((product >= 0) ? product + (1L << (CALGEN_SEGMENT_BITS - 1)) : product - (1L << (CALGEN_SEGMENT_BITS - 1))) / (1L << CALGEN_SEGMENT_BITS);
+        exactC = curve->model((f64)counts / (f64)CALGEN_COUNTS);
+        error = fabs((f64)tenths / CALGEN_TENTHS_PER_C - exactC);
+        if(exactC >= CALGEN_CHECK_MIN_C && exactC <= CALGEN_CHECK_MAX_C && error > maxError)
+        {
+            maxError = error;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return maxError;
+}
+
+/**
+ * @brief Writes the tables
+ *
+ */
+static void CalGen_WriteSource(FILE* file, long tables[][CALGEN_POINTS])
+{
+    uint32_t i;
+    uint32_t j;
+    fprintf(file, "/**\n * @file Cal_Tables.c\n * @author Mark Attia (markjosephattia@gmail.com)\n");
+    fprintf(file, " * @brief The sensor linearization tables in tenths of a degree, generated by water_heater_cal\n");
+    fprintf(file, " *        from SIM/Include/CalGen_Cfg.h, run make cal after changing it instead of editing this file\n");
+    fprintf(file, " * @version 0.1\n * @date 2020-07-05\n *\n * @copyright Copyright (c) 2020\n *\n */\n");
+    fprintf(file, "#include \"Std_Types.h\"\n#include \"Int.h\"\n#include \"Adc.h\"\n#include \"AdcSeq.h\"\n#include \"Cal.h\"\n#include \"Cal_Tables.h\"\n");
+    for(i=0; i<CALGEN_NUMBER_OF_CURVES; i++)
+    {
+        fprintf(file, "\n/* %s */\nconst calTemperature_t %s[CAL_TABLE_POINTS] = {", CalGen_curves[i].description, CalGen_curves[i].name);
+        for(j=0; j<CALGEN_POINTS; j++)
+        {
+            fprintf(file, "%s%s%ld", (j == 0) ? "" : ",", (j % 8 == 0) ? "\n    " : " ", tables[i][j]);
+        }
+        fprintf(file, "\n};\n");
+    }
+}
+
+/**
+ * @brief Writes the header of the tables
+ *
+ */
+static void CalGen_WriteHeader(FILE* file)
+{
+    uint32_t i;
+    fprintf(file, "/**\n * @file Cal_Tables.h\n * @author Mark Attia (markjosephattia@gmail.com)\n");
+    fprintf(file, " * @brief The sensor linearization tables, generated by water_heater_cal from SIM/Include/CalGen_Cfg.h\n");
+    fprintf(file, " * @version 0.1\n * @date 2020-07-05\n *\n * @copyright Copyright (c) 2020\n *\n */\n");
+    fprintf(file, "#ifndef CAL_TABLES_H_\n#define CAL_TABLES_H_\n\n");
+    fprintf(file, "/* The Bits Of The Samples And Of The Segments Between Two Points */\n");
+    fprintf(file, "#define CAL_TABLE_INPUT_BITS                %d\n", CALGEN_INPUT_BITS);
+    fprintf(file, "#define CAL_TABLE_SEGMENT_BITS              %d\n", CALGEN_SEGMENT_BITS);
+    fprintf(file, "#define CAL_TABLE_POINTS                    %lu\n\n", (unsigned long)CALGEN_POINTS);
+    for(i=0; i<CALGEN_NUMBER_OF_CURVES; i++)
+    {
+        fprintf(file, "extern const calTemperature_t %s[CAL_TABLE_POINTS];\n", CalGen_curves[i].name);
+    }
+    fprintf(file, "\n#endif\n");
+}
+
+int main(int argc, char* argv[])
+{
+    static long tables[CALGEN_NUMBER_OF_CURVES][CALGEN_POINTS];
+    const char* sourcePath = CALGEN_DEFAULT_SOURCE;
+    const char* headerPath = CALGEN_DEFAULT_HEADER;
+    FILE* source;
+    FILE* header;
+    uint32_t i;
+    int arg;
+    for(arg=1; arg<argc; arg++)
+    {
+        if(arg + 1 < argc && strcmp(argv[arg], "-c") == 0)
+        {
+            sourcePath = argv[++arg];
+        }
+        else if(arg + 1 < argc && strcmp(argv[arg], "-h") == 0)
+        {
+            headerPath = argv[++arg];
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-c table source] [-h table header]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    source = fopen(sourcePath, "w");
+    header = fopen(headerPath, "w");
+    if(NULL == source || NULL == header)
+    {
+        fprintf(stderr, "%s: cannot write %s or %s\n", argv[0], sourcePath, headerPath);
+        exit(EXIT_FAILURE);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    printf("%lu points, one every %lu counts of %d bits\n", (unsigned long)CALGEN_POINTS, 1UL << CALGEN_SEGMENT_BITS, CALGEN_INPUT_BITS);
+    for(i=0; i<CALGEN_NUMBER_OF_CURVES; i++)
+    {
+        CalGen_Sample(&CalGen_curves[i], tables[i]);
+        printf("%-26s: %.2f C largest interpolation error from %.0f to %.0f C (%s)\n", CalGen_curves[i].name, CalGen_MaxError(&CalGen_curves[i], tables[i]), CALGEN_CHECK_MIN_C, CALGEN_CHECK_MAX_C, CalGen_curves[i].description);
+    }
+    CalGen_WriteSource(source, tables);
+    CalGen_WriteHeader(header);
+    fclose(source);
+    fclose(header);
+    return 0;
+}
@@ -0,0 +1,1223 @@
+/**
+ * @file HwSim.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The host simulation of the PIC16F877A peripherals behind the hardware access layer
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Std_Types.h"
+#include "Hw.h"
+#include "HwSim_Cfg.h"
+#include "HwSim.h"
+
+#define HW_SIM_NEVER                    UINT64_MAX
+
+/* The Simulated Registers */
+#define HW_SIM_INTCON                   0x0B
+#define HW_SIM_PIR1                     0x0C
+#define HW_SIM_TMR1L                    0x0E
+#define HW_SIM_TMR1H                    0x0F
+#define HW_SIM_T1CON                    0x10
+#define HW_SIM_SSPBUF                   0x13
+#define HW_SIM_SSPCON                   0x14
+#define HW_SIM_CCPR1L                   0x15
+#define HW_SIM_CCPR1H                   0x16
+#define HW_SIM_CCP1CON                  0x17
+#define HW_SIM_ADRESH                   0x1E
+#define HW_SIM_ADCON0                   0x1F
+#define HW_SIM_STATUS                   0x03
+#define HW_SIM_OPTION_REG               0x81
+#define HW_SIM_PCON                     0x8E
+#define HW_SIM_TRIS_OFFSET              0x80
+#define HW_SIM_PIE1                     0x8C
+#define HW_SIM_SSPCON2                  0x91
+#define HW_SIM_SSPADD                   0x93
+#define HW_SIM_SSPSTAT                  0x94
+#define HW_SIM_ADRESL                   0x9E
+#define HW_SIM_ADCON1                   0x9F
+
+/* The Register Bits */
+#define HW_SIM_GIE_PEIE                 0xC0
+#define HW_SIM_TO_PD                    0x18
+#define HW_SIM_TO                       0x10
+#define HW_SIM_PSA                      0x08
+#define HW_SIM_PS                       0x07
+#define HW_SIM_ADIF                     0x40
+#define HW_SIM_SSPIF                    0x08
+#define HW_SIM_CCP1IF                   0x04
+#define HW_SIM_TMR1IF                   0x01
+#define HW_SIM_TMR1ON                   0x01
+#define HW_SIM_TMR1CS                   0x02
+#define HW_SIM_T1OSCEN                  0x08
+#define HW_SIM_CCP1_MODE                0x0F
+#define HW_SIM_CCP1_SPECIAL_EVENT       0x0B
+#define HW_SIM_CCP1_SOFT_INT            0x0A
+#define HW_SIM_ADON                     0x01
+#define HW_SIM_GO                       0x04
+#define HW_SIM_ADFM                     0x80
+#define HW_SIM_SSPEN                    0x20
+#define HW_SIM_WCOL                     0x80
+#define HW_SIM_SEN                      0x01
+#define HW_SIM_RSEN                     0x02
+#define HW_SIM_PEN                      0x04
+#define HW_SIM_RCEN                     0x08
+#define HW_SIM_ACKEN                    0x10
+#define HW_SIM_ACKDT                    0x20
+#define HW_SIM_ACKSTAT                  0x40
+#define HW_SIM_SSPCON2_EN               0x1F
+#define HW_SIM_R_W                      0x04
+#define HW_SIM_BF                       0x01
+
+/* The I2C Master Operations */
+#define HW_SIM_I2C_NONE                 0
+#define HW_SIM_I2C_START                1
+#define HW_SIM_I2C_STOP                 2
+#define HW_SIM_I2C_TX                   3
+#define HW_SIM_I2C_RX                   4
+#define HW_SIM_I2C_ACK                  5
+
+/* The EEPROM Slave States */
+#define HW_SIM_EEPROM_IDLE              0
+#define HW_SIM_EEPROM_CONTROL           1
+#define HW_SIM_EEPROM_ADDRESS_HIGH      2
+#define HW_SIM_EEPROM_ADDRESS_LOW       3
+#define HW_SIM_EEPROM_WRITING           4
+#define HW_SIM_EEPROM_READING           5
+
+#define HW_SIM_NUMBER_OF_PORTS          5
+#define HW_SIM_PORT_INDEX(port)         ((port) - HW_SIM_PORTA)
+
+typedef struct
+{
+    uint64_t nextEvent;
+    uint64_t endCycle;
+    uint8_t irqPending;
+    uint8_t inIsr;
+    /* Ports */
+    uint8_t pinLevel[HW_SIM_NUMBER_OF_PORTS];
+    uint8_t latch[HW_SIM_NUMBER_OF_PORTS];
+    /* Timer 1 And CCP1 */
+    uint16_t tmr1Value;
+    uint64_t tmr1Stamp;
+    uint64_t compareEvent;
+    uint64_t overflowEvent;
+    uint64_t ticks;
+    /* The Cycle The Timer 1 Crystal Gives Its First Edge */
+    uint64_t oscReady;
+    /* The Cycles The Firmware Spent Waiting In HW_IDLE Or HW_SLEEP */
+    uint64_t idleCycles;
+    /* The Cycles The Instruction Clock Was Stopped By HW_SLEEP */
+    uint64_t sleepCycles;
+    /* Watchdog */
+    uint64_t wdtClear;
+    uint64_t wdtLongestGap;
+    uint32_t wdtTimeouts;
+    /* ADC */
+    uint64_t adcEvent;
+    /* I2C Master */
+    uint8_t i2cOp;
+    uint8_t i2cData;
+    uint64_t i2cEvent;
+    /* EEPROM Slave */
+    uint8_t eepromState;
+    uint16_t eepromAddress;
+    uint8_t eepromPageDirty;
+    uint8_t eepromPage[HW_SIM_EEPROM_PAGE_SIZE];
+    uint64_t eepromEvent;
+    uint8_t eeprom[HW_SIM_EEPROM_SIZE];
+    /* The Page Writes Still To Be Refused */
+    uint32_t eepromWriteFaults;
+    /* Hooks */
+    HwSim_Hook_t stopHandler;
+    HwSim_Hook_t tickHook;
+    HwSim_AdcSource_t adcSource;
+} hwSim_t;
+
+extern void ISR(void);
+
+static void HwSim_DefaultStop(void);
+
+static HW_INSTANCE hwSim_t HwSim;
+
+HW_INSTANCE hwCore_t Hw_core;
+
+/* Reads Of Timer 1, SSPBUF And The INTCON Mirrors Go Through The Models,
+ * The Ports Keep The Level Seen By The Firmware In The Register File */
+const uint8_t Hw_modelRead[HW_REG_FILE_SIZE] = {
+    [HW_SIM_TMR1L] = 1, [HW_SIM_TMR1H] = 1, [HW_SIM_SSPBUF] = 1,
+    [0x080 | HW_SIM_INTCON] = 1, [0x100 | HW_SIM_INTCON] = 1, [0x180 | HW_SIM_INTCON] = 1
+};
+
+/* Writes That Start Or Reconfigure A Peripheral Go Through The Models */
+const uint8_t Hw_modelWrite[HW_REG_FILE_SIZE] = {
+    [HW_SIM_PORTA] = 1, [HW_SIM_PORTB] = 1, [HW_SIM_PORTC] = 1, [HW_SIM_PORTD] = 1, [HW_SIM_PORTE] = 1,
+    [HW_SIM_PORTA + HW_SIM_TRIS_OFFSET] = 1, [HW_SIM_PORTB + HW_SIM_TRIS_OFFSET] = 1, [HW_SIM_PORTC + HW_SIM_TRIS_OFFSET] = 1,
+    [HW_SIM_PORTD + HW_SIM_TRIS_OFFSET] = 1, [HW_SIM_PORTE + HW_SIM_TRIS_OFFSET] = 1,
+    [HW_SIM_INTCON] = 1, [HW_SIM_PIR1] = 1, [HW_SIM_PIE1] = 1,
+    [HW_SIM_TMR1L] = 1, [HW_SIM_TMR1H] = 1, [HW_SIM_T1CON] = 1,
+    [HW_SIM_CCPR1L] = 1, [HW_SIM_CCPR1H] = 1, [HW_SIM_CCP1CON] = 1,
+    [HW_SIM_ADCON0] = 1, [HW_SIM_SSPBUF] = 1, [HW_SIM_SSPCON] = 1, [HW_SIM_SSPCON2] = 1,
+    [0x080 | HW_SIM_INTCON] = 1, [0x100 | HW_SIM_INTCON] = 1, [0x180 | HW_SIM_INTCON] = 1
+};
+
+/**
+ * @brief Returns a mid scale sample when no analog source is attached
+ *
+ */
+static uint16_t HwSim_DefaultAdcSource(uint8_t channel)
+{
+    (void)channel;
+    return 0x200;
+}
+
+/**
+ * @brief Normalizes the mirrored registers to their bank 0 address
+ *
+ */
+static uint16_t HwSim_Normalize(uint16_t address)
+{
+    address &= (HW_REG_FILE_SIZE - 1);
+    if((address & 0x7F) == HW_SIM_INTCON)
+    {
+        address = HW_SIM_INTCON;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return address;
+}
+
+/**
+ * @brief Pulls the fast path deadline in for the next event or a pending interrupt
+ *
+ */
+static void HwSim_UpdateDeadline(void)
+{
+    Hw_core.deadline = (HwSim.irqPending && !HwSim.inIsr) ? 0 : HwSim.nextEvent;
+}
+
+/**
+ * @brief Recomputes whether an interrupt should be taken
+ *
+ */
+static void HwSim_UpdateIrq(void)
+{
+    HwSim.irqPending = ((Hw_core.reg[HW_SIM_INTCON] & HW_SIM_GIE_PEIE) == HW_SIM_GIE_PEIE)
+                        && (Hw_core.reg[HW_SIM_PIR1] & Hw_core.reg[HW_SIM_PIE1]);
+    HwSim_UpdateDeadline();
+}
+
+/**
+ * @brief Raises a peripheral interrupt flag
+ *
+ */
+static void HwSim_RaiseFlag(uint8_t flag)
+{
+    Hw_core.reg[HW_SIM_PIR1] |= flag;
+    HwSim_UpdateIrq();
+}
+
+/**
+ * @brief The clock edges Timer 1 got until a cycle, the instruction clock or the crystal
+ *
+ */
+static uint64_t HwSim_Tmr1Clocks(uint64_t cycles)
+{
+    uint64_t clocks = cycles;
+    if(Hw_core.reg[HW_SIM_T1CON] & HW_SIM_TMR1CS)
+    {
+        /* The Crystal Is The Only External Clock, It Counts Once It Started */
+        clocks = (cycles > HwSim.oscReady) ? (cycles - HwSim.oscReady) * HW_SIM_T1OSC_CLK / HW_SIM_CYCLES_PER_SECOND : 0;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return clocks;
+}
+
+/**
+ * @brief The current value of Timer 1
+ *
+ */
+static uint16_t HwSim_Tmr1(void)
+{
+    uint16_t value = HwSim.tmr1Value;
+    uint8_t prescaler;
+    if(Hw_core.reg[HW_SIM_T1CON] & HW_SIM_TMR1ON)
+    {
+        prescaler = (Hw_core.reg[HW_SIM_T1CON] >> 4) & 0x03;
+        value += (uint16_t)((HwSim_Tmr1Clocks(Hw_core.cycles) - HwSim_Tmr1Clocks(HwSim.tmr1Stamp)) >> prescaler);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return value;
+}
+
+/**
+ * @brief Freezes the timer value before its configuration changes
+ *
+ */
+static void HwSim_Tmr1Sync(void)
+{
+    HwSim.tmr1Value = HwSim_Tmr1();
+    HwSim.tmr1Stamp = Hw_core.cycles;
+}
+
+/**
+ * @brief Finds the earliest pending event
+ *
+ */
+static void HwSim_UpdateNextEvent(void)
+{
+    uint64_t next = HwSim.endCycle;
+    if(HwSim.compareEvent < next)
+    {
+        next = HwSim.compareEvent;
+    }
+    if(HwSim.overflowEvent < next)
+    {
+        next = HwSim.overflowEvent;
+    }
+    if(HwSim.adcEvent < next)
+    {
+        next = HwSim.adcEvent;
+    }
+    if(HwSim.i2cEvent < next)
+    {
+        next = HwSim.i2cEvent;
+    }
+    if(HwSim.eepromEvent < next)
+    {
+        next = HwSim.eepromEvent;
+    }
+    HwSim.nextEvent = next;
+    HwSim_UpdateDeadline();
+}
+
+/**
+ * @brief Computes when Timer 1 overflows while its interrupt is enabled
+ *
+ */
+static void HwSim_ScheduleOverflow(void)
+{
+    uint64_t clocks;
+    uint64_t from;
+    HwSim.overflowEvent = HW_SIM_NEVER;
+    if((Hw_core.reg[HW_SIM_T1CON] & HW_SIM_TMR1ON) && (Hw_core.reg[HW_SIM_PIE1] & HW_SIM_TMR1IF))
+    {
+        clocks = ((uint64_t)0x10000 - HwSim_Tmr1()) << ((Hw_core.reg[HW_SIM_T1CON] >> 4) & 0x03);
+        if(!(Hw_core.reg[HW_SIM_T1CON] & HW_SIM_TMR1CS))
+        {
+            HwSim.overflowEvent = Hw_core.cycles + clocks;
+        }
+        else if(HwSim.oscReady != HW_SIM_NEVER)
+        {
+            /* The Cycle Of The Crystal Edge That Overflows */
+            from = (Hw_core.cycles > HwSim.oscReady) ? Hw_core.cycles : HwSim.oscReady;
+            clocks += HwSim_Tmr1Clocks(from);
+            HwSim.overflowEvent = HwSim.oscReady + (clocks * HW_SIM_CYCLES_PER_SECOND + HW_SIM_T1OSC_CLK - 1) / HW_SIM_T1OSC_CLK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Computes when Timer 1 will match CCPR1 and when it overflows,
+ *        the compare does not work while Timer 1 counts the crystal asynchronously
+ *
+ */
+static void HwSim_ScheduleCompare(void)
+{
+    uint8_t mode = Hw_core.reg[HW_SIM_CCP1CON] & HW_SIM_CCP1_MODE;
+    uint16_t compare = (uint16_t)Hw_core.reg[HW_SIM_CCPR1L] | ((uint16_t)Hw_core.reg[HW_SIM_CCPR1H] << 8);
+    uint16_t distance;
+    uint8_t prescaler;
+    HwSim.compareEvent = HW_SIM_NEVER;
+    if((Hw_core.reg[HW_SIM_T1CON] & (HW_SIM_TMR1ON | HW_SIM_TMR1CS)) == HW_SIM_TMR1ON
+       && (mode == HW_SIM_CCP1_SPECIAL_EVENT || mode == HW_SIM_CCP1_SOFT_INT))
+    {
+        prescaler = (Hw_core.reg[HW_SIM_T1CON] >> 4) & 0x03;
+        distance = (uint16_t)(compare - HwSim_Tmr1());
+        HwSim.compareEvent = Hw_core.cycles + (((uint64_t)(distance ? distance : 0x10000)) << prescaler);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    HwSim_ScheduleOverflow();
+    HwSim_UpdateNextEvent();
+}
+
+/**
+ * @brief The Timer 1 overflow, it keeps counting
+ *
+ */
+static void HwSim_Overflow(void)
+{
+    HwSim_RaiseFlag(HW_SIM_TMR1IF);
+    HwSim_ScheduleOverflow();
+}
+
+/**
+ * @brief The CCP1 compare match
+ *
+ */
+static void HwSim_CompareMatch(void)
+{
+    HwSim.ticks++;
+    if((Hw_core.reg[HW_SIM_CCP1CON] & HW_SIM_CCP1_MODE) == HW_SIM_CCP1_SPECIAL_EVENT)
+    {
+        /* The Special Event Trigger Resets Timer 1 */
+        HwSim.tmr1Value = 0;
+        HwSim.tmr1Stamp = Hw_core.cycles;
+    }
+    else
+    {
+        HwSim_Tmr1Sync();
+    }
+    HwSim_RaiseFlag(HW_SIM_CCP1IF);
+    if(HwSim.tickHook)
+    {
+        HwSim.tickHook();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    HwSim_ScheduleCompare();
+}
+
+/**
+ * @brief The end of an ADC conversion
+ *
+ */
+static void HwSim_AdcDone(void)
+{
+    uint8_t channel = (Hw_core.reg[HW_SIM_ADCON0] >> 3) & 0x07;
+    uint16_t value = HwSim.adcSource(channel) & 0x3FF;
+    HwSim.adcEvent = HW_SIM_NEVER;
+    if(Hw_core.reg[HW_SIM_ADCON1] & HW_SIM_ADFM)
+    {
+        Hw_core.reg[HW_SIM_ADRESH] = (uint8_t)(value >> 8);
+        Hw_core.reg[HW_SIM_ADRESL] = (uint8_t)value;
+    }
+    else
+    {
+        Hw_core.reg[HW_SIM_ADRESH] = (uint8_t)(value >> 2);
+        Hw_core.reg[HW_SIM_ADRESL] = (uint8_t)(value << 6);
+    }
+    Hw_core.reg[HW_SIM_ADCON0] &= (uint8_t)~HW_SIM_GO;
+    HwSim_RaiseFlag(HW_SIM_ADIF);
+}
+
+/**
+ * @brief The EEPROM sees a start condition
+ *
+ */
+static void HwSim_EepromStart(void)
+{
+    HwSim.eepromState = HW_SIM_EEPROM_CONTROL;
+}
+
+/**
+ * @brief The EEPROM sees a stop condition, a written page starts its write cycle
+ *
+ */
+static void HwSim_EepromStop(void)
+{
+    if(HwSim.eepromPageDirty && HwSim.eepromEvent == HW_SIM_NEVER)
+    {
+        HwSim.eepromEvent = Hw_core.cycles + HW_SIM_EEPROM_WRITE_CYCLES;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    HwSim.eepromState = HW_SIM_EEPROM_IDLE;
+}
+
+/**
+ * @brief The EEPROM write cycle is done
+ *
+ */
+static void HwSim_EepromCommit(void)
+{
+    uint16_t base = HwSim.eepromAddress & (uint16_t)~(HW_SIM_EEPROM_PAGE_SIZE - 1);
+    memcpy(&HwSim.eeprom[base], HwSim.eepromPage, HW_SIM_EEPROM_PAGE_SIZE);
+    HwSim.eepromPageDirty = 0;
+    HwSim.eepromEvent = HW_SIM_NEVER;
+}
+
+/**
+ * @brief The EEPROM receives a byte and returns its acknowledge
+ *
+ */
+static uint8_t HwSim_EepromReceive(uint8_t data)
+{
+    uint8_t ack = 0;
+    uint16_t base;
+    switch(HwSim.eepromState)
+    {
+        case HW_SIM_EEPROM_CONTROL:
+            /* A Busy Device Does Not Acknowledge Its Address */
+            if((data & 0xFE) == HW_SIM_EEPROM_DEVICE_ADDRESS && HwSim.eepromEvent == HW_SIM_NEVER)
+            {
+                HwSim.eepromState = (data & 0x01) ? HW_SIM_EEPROM_READING : HW_SIM_EEPROM_ADDRESS_HIGH;
+                ack = 1;
+            }
+            else
+            {
+                HwSim.eepromState = HW_SIM_EEPROM_IDLE;
+            }
+            break;
+        case HW_SIM_EEPROM_ADDRESS_HIGH:
+            HwSim.eepromAddress = (uint16_t)(data << 8);
+            HwSim.eepromState = HW_SIM_EEPROM_ADDRESS_LOW;
+            ack = 1;
+            break;
+        case HW_SIM_EEPROM_ADDRESS_LOW:
+            HwSim.eepromAddress = (uint16_t)((HwSim.eepromAddress | data) & (HW_SIM_EEPROM_SIZE - 1));
+            HwSim.eepromState = HW_SIM_EEPROM_WRITING;
+            ack = 1;
+            break;
+        case HW_SIM_EEPROM_WRITING:
+            /* The Data Is Latched In The Page Buffer, The Address Rolls Over Inside The Page */
+            base = HwSim.eepromAddress & (uint16_t)~(HW_SIM_EEPROM_PAGE_SIZE - 1);
+            if(!HwSim.eepromPageDirty && HwSim.eepromWriteFaults)
+            {
+                /* An Injected Fault, The First Byte Is Not Acknowledged And Nothing Is Written */
+                HwSim.eepromWriteFaults--;
+                HwSim.eepromState = HW_SIM_EEPROM_IDLE;
+                break;
+            }
+            else if(!HwSim.eepromPageDirty)
+            {
+                memcpy(HwSim.eepromPage, &HwSim.eeprom[base], HW_SIM_EEPROM_PAGE_SIZE);
+                HwSim.eepromPageDirty = 1;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+            HwSim.eepromPage[HwSim.eepromAddress - base] = data;
+            HwSim.eepromAddress = base | ((HwSim.eepromAddress + 1) & (HW_SIM_EEPROM_PAGE_SIZE - 1));
+            ack = 1;
+            break;
+        default:
+            break;
+    }
+    return ack;
+}
+
+/**
+ * @brief The EEPROM transmits a byte
+ *
+ */
+static uint8_t HwSim_EepromTransmit(void)
+{
+    uint8_t data = 0xFF;
+    if(HwSim.eepromState == HW_SIM_EEPROM_READING)
+    {
+        data = HwSim.eeprom[HwSim.eepromAddress];
+        HwSim.eepromAddress = (HwSim.eepromAddress + 1) & (HW_SIM_EEPROM_SIZE - 1);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return data;
+}
+
+/**
+ * @brief The I2C bit time in instruction cycles
+ *
+ */
+static uint64_t HwSim_I2cBit(void)
+{
+    return (uint64_t)Hw_core.reg[HW_SIM_SSPADD] + 1;
+}
+
+/**
+ * @brief Starts an I2C master operation
+ *
+ */
+static void HwSim_I2cBegin(uint8_t op, uint64_t bits)
+{
+    HwSim.i2cOp = op;
+    HwSim.i2cEvent = Hw_core.cycles + bits * HwSim_I2cBit();
+    HwSim_UpdateNextEvent();
+}
+
+/**
+ * @brief The end of an I2C master operation
+ *
+ */
+static void HwSim_I2cDone(void)
+{
+    switch(HwSim.i2cOp)
+    {
+        case HW_SIM_I2C_START:
+            Hw_core.reg[HW_SIM_SSPCON2] &= (uint8_t)~(HW_SIM_SEN | HW_SIM_RSEN);
+            HwSim_EepromStart();
+            break;
+        case HW_SIM_I2C_STOP:
+            Hw_core.reg[HW_SIM_SSPCON2] &= (uint8_t)~HW_SIM_PEN;
+            HwSim_EepromStop();
+            break;
+        case HW_SIM_I2C_TX:
+            Hw_core.reg[HW_SIM_SSPSTAT] &= (uint8_t)~(HW_SIM_R_W | HW_SIM_BF);
+            if(HwSim_EepromReceive(HwSim.i2cData))
+            {
+                Hw_core.reg[HW_SIM_SSPCON2] &= (uint8_t)~HW_SIM_ACKSTAT;
+            }
+            else
+            {
+                Hw_core.reg[HW_SIM_SSPCON2] |= HW_SIM_ACKSTAT;
+            }
+            break;
+        case HW_SIM_I2C_RX:
+            Hw_core.reg[HW_SIM_SSPCON2] &= (uint8_t)~HW_SIM_RCEN;
+            Hw_core.reg[HW_SIM_SSPBUF] = HwSim_EepromTransmit();
+            Hw_core.reg[HW_SIM_SSPSTAT] |= HW_SIM_BF;
+            break;
+        case HW_SIM_I2C_ACK:
+            Hw_core.reg[HW_SIM_SSPCON2] &= (uint8_t)~HW_SIM_ACKEN;
+            /* A Not Acknowledge Ends The Sequential Read */
+            if(Hw_core.reg[HW_SIM_SSPCON2] & HW_SIM_ACKDT)
+            {
+                HwSim.eepromState = HW_SIM_EEPROM_IDLE;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+            break;
+        default:
+            break;
+    }
+    HwSim.i2cOp = HW_SIM_I2C_NONE;
+    HwSim.i2cEvent = HW_SIM_NEVER;
+    HwSim_RaiseFlag(HW_SIM_SSPIF);
+}
+
+/**
+ * @brief Handles a write to SSPCON2, the enable bits start the master operations
+ *
+ */
+static void HwSim_I2cControl(uint8_t value)
+{
+    uint8_t started = (uint8_t)(value & ~Hw_core.reg[HW_SIM_SSPCON2] & HW_SIM_SSPCON2_EN);
+    Hw_core.reg[HW_SIM_SSPCON2] = (uint8_t)((value & ~HW_SIM_ACKSTAT) | (Hw_core.reg[HW_SIM_SSPCON2] & HW_SIM_ACKSTAT));
+    if(started && HwSim.i2cOp == HW_SIM_I2C_NONE && (Hw_core.reg[HW_SIM_SSPCON] & HW_SIM_SSPEN))
+    {
+        if(started & (HW_SIM_SEN | HW_SIM_RSEN))
+        {
+            HwSim_I2cBegin(HW_SIM_I2C_START, 1);
+        }
+        else if(started & HW_SIM_PEN)
+        {
+            HwSim_I2cBegin(HW_SIM_I2C_STOP, 1);
+        }
+        else if(started & HW_SIM_RCEN)
+        {
+            HwSim_I2cBegin(HW_SIM_I2C_RX, 8);
+        }
+        else
+        {
+            HwSim_I2cBegin(HW_SIM_I2C_ACK, 1);
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Handles a write to SSPCON, clearing SSPEN resets the master and drops the operation in progress,
+ *        the bus recovery of the firmware ends with a stop on the pins which the slave sees here
+ *
+ */
+static void HwSim_I2cEnable(uint8_t value)
+{
+    if((Hw_core.reg[HW_SIM_SSPCON] & HW_SIM_SSPEN) && !(value & HW_SIM_SSPEN))
+    {
+        HwSim.i2cOp = HW_SIM_I2C_NONE;
+        HwSim.i2cEvent = HW_SIM_NEVER;
+        Hw_core.reg[HW_SIM_SSPCON2] &= (uint8_t)~HW_SIM_SSPCON2_EN;
+        Hw_core.reg[HW_SIM_SSPSTAT] &= (uint8_t)~(HW_SIM_R_W | HW_SIM_BF);
+        HwSim_EepromStop();
+        HwSim_UpdateNextEvent();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    Hw_core.reg[HW_SIM_SSPCON] = value;
+}
+
+/**
+ * @brief Handles a write to SSPBUF, starts a transmission when the bus is free
+ *
+ */
+static void HwSim_I2cTransmit(uint8_t value)
+{
+    if(HwSim.i2cOp != HW_SIM_I2C_NONE || (Hw_core.reg[HW_SIM_SSPCON2] & HW_SIM_SSPCON2_EN))
+    {
+        Hw_core.reg[HW_SIM_SSPCON] |= HW_SIM_WCOL;
+    }
+    else
+    {
+        Hw_core.reg[HW_SIM_SSPBUF] = value;
+        HwSim.i2cData = value;
+        Hw_core.reg[HW_SIM_SSPSTAT] |= HW_SIM_R_W | HW_SIM_BF;
+        HwSim_I2cBegin(HW_SIM_I2C_TX, 9);
+    }
+}
+
+/**
+ * @brief Runs all the events that are due
+ *
+ */
+static void HwSim_RunEvents(void)
+{
+    uint64_t now = Hw_core.cycles;
+    while(HwSim.nextEvent <= now)
+    {
+        /* Every Event Is Handled At Its Own Time */
+        Hw_core.cycles = HwSim.nextEvent;
+        if(Hw_core.cycles >= HwSim.endCycle)
+        {
+            HwSim.endCycle = HW_SIM_NEVER;
+            HwSim.stopHandler();
+        }
+        else if(Hw_core.cycles == HwSim.compareEvent)
+        {
+            HwSim_CompareMatch();
+        }
+        else if(Hw_core.cycles == HwSim.overflowEvent)
+        {
+            HwSim_Overflow();
+        }
+        else if(Hw_core.cycles == HwSim.adcEvent)
+        {
+            HwSim_AdcDone();
+        }
+        else if(Hw_core.cycles == HwSim.i2cEvent)
+        {
+            HwSim_I2cDone();
+        }
+        else
+        {
+            HwSim_EepromCommit();
+        }
+        HwSim_UpdateNextEvent();
+    }
+    Hw_core.cycles = now;
+}
+
+/**
+ * @brief Runs the events that became due, the access is already charged
+ *
+ */
+static void HwSim_Advance(void)
+{
+    if(Hw_core.cycles >= HwSim.nextEvent)
+    {
+        HwSim_RunEvents();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Runs the due events and takes a pending interrupt, interrupts are only taken
+ *        before a read so a read-modify-write is never split
+ *
+ */
+static void HwSim_Step(void)
+{
+    HwSim_Advance();
+    if(HwSim.irqPending && !HwSim.inIsr)
+    {
+        HwSim.inIsr = 1;
+        HwSim_UpdateDeadline();
+        ISR();
+        HwSim.inIsr = 0;
+        HwSim_UpdateDeadline();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Recomputes the level the firmware reads from a port,
+ *        inputs read the pins and outputs read the latch
+ *
+ */
+static void HwSim_UpdatePort(uint8_t port)
+{
+    uint8_t tris = Hw_core.reg[port + HW_SIM_TRIS_OFFSET];
+    Hw_core.reg[port] = (uint8_t)((HwSim.latch[HW_SIM_PORT_INDEX(port)] & ~tris) | (HwSim.pinLevel[HW_SIM_PORT_INDEX(port)] & tris));
+}
+
+/**
+ * @brief Reads a register that has a peripheral model or when an event is due
+ *
+ * @param address The data memory address of the register
+ * @return uint8_t The register value
+ */
+uint8_t Hw_ModelRead8(uint16_t address)
+{
+    uint8_t value;
+    HwSim_Step();
+    address = HwSim_Normalize(address);
+    switch(address)
+    {
+        case HW_SIM_TMR1L:
+            value = (uint8_t)HwSim_Tmr1();
+            break;
+        case HW_SIM_TMR1H:
+            value = (uint8_t)(HwSim_Tmr1() >> 8);
+            break;
+        case HW_SIM_SSPBUF:
+            Hw_core.reg[HW_SIM_SSPSTAT] &= (uint8_t)~HW_SIM_BF;
+            value = Hw_core.reg[address];
+            break;
+        default:
+            value = Hw_core.reg[address];
+            break;
+    }
+    return value;
+}
+
+/**
+ * @brief Writes a register that has a peripheral model or when an event is due
+ *
+ * @param address The data memory address of the register
+ * @param value The value to write
+ */
+void Hw_ModelWrite8(uint16_t address, uint8_t value)
+{
+    uint8_t old;
+    HwSim_Advance();
+    address = HwSim_Normalize(address);
+    old = Hw_core.reg[address];
+    switch(address)
+    {
+        case HW_SIM_PORTA:
+        case HW_SIM_PORTB:
+        case HW_SIM_PORTC:
+        case HW_SIM_PORTD:
+        case HW_SIM_PORTE:
+            HwSim.latch[HW_SIM_PORT_INDEX(address)] = value;
+            HwSim_UpdatePort((uint8_t)address);
+            break;
+        case HW_SIM_PORTA + HW_SIM_TRIS_OFFSET:
+        case HW_SIM_PORTB + HW_SIM_TRIS_OFFSET:
+        case HW_SIM_PORTC + HW_SIM_TRIS_OFFSET:
+        case HW_SIM_PORTD + HW_SIM_TRIS_OFFSET:
+        case HW_SIM_PORTE + HW_SIM_TRIS_OFFSET:
+            Hw_core.reg[address] = value;
+            HwSim_UpdatePort((uint8_t)(address - HW_SIM_TRIS_OFFSET));
+            break;
+        case HW_SIM_TMR1L:
+            HwSim_Tmr1Sync();
+            HwSim.tmr1Value = (HwSim.tmr1Value & 0xFF00) | value;
+            HwSim_ScheduleCompare();
+            break;
+        case HW_SIM_TMR1H:
+            HwSim_Tmr1Sync();
+            HwSim.tmr1Value = (HwSim.tmr1Value & 0x00FF) | (uint16_t)(value << 8);
+            HwSim_ScheduleCompare();
+            break;
+        case HW_SIM_T1CON:
+            HwSim_Tmr1Sync();
+            /* The Crystal Needs Its Start-Up Time Whenever Its Oscillator Is Turned On */
+            if(!(value & HW_SIM_T1OSCEN))
+            {
+                HwSim.oscReady = HW_SIM_NEVER;
+            }
+            else if(!(old & HW_SIM_T1OSCEN))
+            {
+                HwSim.oscReady = Hw_core.cycles + HW_SIM_T1OSC_START_CYCLES;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+            Hw_core.reg[address] = value;
+            HwSim_ScheduleCompare();
+            break;
+        case HW_SIM_CCPR1L:
+        case HW_SIM_CCPR1H:
+        case HW_SIM_CCP1CON:
+            HwSim_Tmr1Sync();
+            Hw_core.reg[address] = value;
+            HwSim_ScheduleCompare();
+            break;
+        case HW_SIM_ADCON0:
+            Hw_core.reg[address] = value;
+            if((value & HW_SIM_GO) && !(old & HW_SIM_GO) && (value & HW_SIM_ADON))
+            {
+                HwSim.adcEvent = Hw_core.cycles + HW_SIM_ADC_CONVERSION_CYCLES;
+            }
+            else if(!(value & HW_SIM_GO))
+            {
+                /* Clearing GO Aborts The Conversion */
+                HwSim.adcEvent = HW_SIM_NEVER;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+            HwSim_UpdateNextEvent();
+            break;
+        case HW_SIM_SSPBUF:
+            HwSim_I2cTransmit(value);
+            break;
+        case HW_SIM_SSPCON:
+            HwSim_I2cEnable(value);
+            break;
+        case HW_SIM_SSPCON2:
+            HwSim_I2cControl(value);
+            break;
+        case HW_SIM_INTCON:
+        case HW_SIM_PIR1:
+            Hw_core.reg[address] = value;
+            HwSim_UpdateIrq();
+            break;
+        case HW_SIM_PIE1:
+            Hw_core.reg[address] = value;
+            HwSim_ScheduleOverflow();
+            HwSim_UpdateNextEvent();
+            HwSim_UpdateIrq();
+            break;
+        default:
+            Hw_core.reg[address] = value;
+            break;
+    }
+}
+
+/**
+ * @brief Advances the simulated time to the next peripheral event
+ *
+ */
+void Hw_Idle(void)
+{
+    if(HwSim.nextEvent == HW_SIM_NEVER)
+    {
+        fprintf(stderr, "HwSim: idle with no pending event, the firmware would sleep forever\n");
+        exit(EXIT_FAILURE);
+    }
+    else if(HwSim.irqPending && !HwSim.inIsr)
+    {
+        /* A Pending Interrupt Ends The Wait At Once */
+    }
+    else if(HwSim.nextEvent > Hw_core.cycles)
+    {
+        HwSim.idleCycles += HwSim.nextEvent - Hw_core.cycles;
+        Hw_core.cycles = HwSim.nextEvent;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    HwSim_Step();
+}
+
+/**
+ * @brief Stops the simulated instruction clock until an enabled interrupt flag is set, the events in between
+ *        still run and the oscillator start-up timer comes on top, the peripherals on the instruction clock must be idle
+ *
+ */
+void Hw_Sleep(void)
+{
+    uint64_t start = Hw_core.cycles;
+    HwSim_Advance();
+    /* SLEEP Clears The Watchdog, Sets TO And Clears PD */
+    Hw_ClearWatchdog();
+    Hw_core.reg[HW_SIM_STATUS] = (uint8_t)((Hw_core.reg[HW_SIM_STATUS] & ~HW_SIM_TO_PD) | HW_SIM_TO);
+    if(Hw_core.reg[HW_SIM_PIR1] & Hw_core.reg[HW_SIM_PIE1])
+    {
+        /* SLEEP Is A NOP While An Enabled Flag Is Pending */
+    }
+    else if(HwSim.adcEvent != HW_SIM_NEVER || HwSim.i2cOp != HW_SIM_I2C_NONE)
+    {
+        fprintf(stderr, "HwSim: sleep during an ADC conversion or an I2C operation, their clock stops\n");
+        exit(EXIT_FAILURE);
+    }
+    else if(HwSim.overflowEvent == HW_SIM_NEVER)
+    {
+        fprintf(stderr, "HwSim: sleep with no wake up source, the firmware would sleep forever\n");
+        exit(EXIT_FAILURE);
+    }
+    else
+    {
+        /* The EEPROM Write Cycle And The End Of The Run Still Come While The Core Sleeps */
+        Hw_core.cycles = HwSim.overflowEvent;
+        HwSim_RunEvents();
+        Hw_core.cycles += HW_SIM_OST_CYCLES;
+        HwSim.idleCycles += Hw_core.cycles - start;
+        HwSim.sleepCycles += Hw_core.cycles - start;
+    }
+}
+
+/**
+ * @brief Clears the simulated watchdog timer, a gap longer than the nominal period is counted as a time out,
+ *        the firmware keeps running since a reset would end the scenario
+ *
+ */
+void Hw_ClearWatchdog(void)
+{
+    uint64_t period = HW_SIM_WDT_PERIOD_CYCLES;
+    uint64_t gap = Hw_core.cycles - HwSim.wdtClear;
+    /* The Prescaler Only Stretches The Watchdog When It Is Assigned To It */
+    if(Hw_core.reg[HW_SIM_OPTION_REG] & HW_SIM_PSA)
+    {
+        period <<= (Hw_core.reg[HW_SIM_OPTION_REG] & HW_SIM_PS);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(gap > HwSim.wdtLongestGap)
+    {
+        HwSim.wdtLongestGap = gap;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(gap > period)
+    {
+        HwSim.wdtTimeouts++;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    HwSim.wdtClear = Hw_core.cycles;
+}
+
+/**
+ * @brief Puts the register file, the peripherals and the EEPROM in their power on state
+ *
+ */
+void HwSim_Reset(void)
+{
+    memset(&HwSim, 0, sizeof(HwSim));
+    memset(&Hw_core, 0, sizeof(Hw_core));
+    /* TRIS And OPTION_REG Come Out Of Reset As All Ones */
+    memset(&Hw_core.reg[HW_SIM_PORTA + HW_SIM_TRIS_OFFSET], 0xFF, HW_SIM_NUMBER_OF_PORTS);
+    Hw_core.reg[HW_SIM_OPTION_REG] = 0xFF;
+    /* A Power On Reset, TO And PD Are Set And POR Is Cleared */
+    Hw_core.reg[HW_SIM_STATUS] = HW_SIM_TO_PD;
+    Hw_core.reg[HW_SIM_PCON] = 0x00;
+    /* Port B Buttons Are Pulled Up */
+    HwSim_SetPins(HW_SIM_PORTB, 0xFF, 1);
+    /* The I2C Lines Are Pulled Up, RC3 Is SCL And RC4 Is SDA */
+    HwSim_SetPins(HW_SIM_PORTC, 0x18, 1);
+    memset(HwSim.eeprom, 0xFF, sizeof(HwSim.eeprom));
+    HwSim.compareEvent = HW_SIM_NEVER;
+    HwSim.overflowEvent = HW_SIM_NEVER;
+    HwSim.oscReady = HW_SIM_NEVER;
+    HwSim.adcEvent = HW_SIM_NEVER;
+    HwSim.i2cEvent = HW_SIM_NEVER;
+    HwSim.eepromEvent = HW_SIM_NEVER;
+    HwSim.endCycle = HW_SIM_DEFAULT_RUN_TIME_S * HW_SIM_CYCLES_PER_SECOND;
+    HwSim.stopHandler = HwSim_DefaultStop;
+    HwSim.adcSource = HwSim_DefaultAdcSource;
+    HwSim_UpdateNextEvent();
+}
+
+/**
+ * @brief Sets the simulated run time, the stop handler is called when it elapses
+ *
+ * @param cycles The run time in instruction cycles
+ */
+void HwSim_SetRunTime(uint64_t cycles)
+{
+    HwSim.endCycle = cycles;
+    HwSim_UpdateNextEvent();
+}
+
+/**
+ * @brief Gets the simulated time since reset
+ *
+ * @return uint64_t The time in instruction cycles
+ */
+uint64_t HwSim_GetCycles(void)
+{
+    return Hw_core.cycles;
+}
+
+/**
+ * @brief Gets the time the firmware spent waiting in HW_IDLE or HW_SLEEP
+ *
+ * @return uint64_t The time in instruction cycles
+ */
+uint64_t HwSim_GetIdleCycles(void)
+{
+    return HwSim.idleCycles;
+}
+
+/**
+ * @brief Gets the time the instruction clock was stopped by HW_SLEEP
+ *
+ * @return uint64_t The time in instruction cycles
+ */
+uint64_t HwSim_GetSleepCycles(void)
+{
+    return HwSim.sleepCycles;
+}
+
+/**
+ * @brief Gets the number of CCP1 compare matches, every match wakes the firmware up
+ *
+ * @return uint64_t The number of compare matches
+ */
+uint64_t HwSim_GetCompareMatches(void)
+{
+    return HwSim.ticks;
+}
+
+/**
+ * @brief Gets the longest time between two clears of the watchdog, the time since the last clear included
+ *
+ * @return uint64_t The time in instruction cycles
+ */
+uint64_t HwSim_GetLongestWatchdogGap(void)
+{
+    uint64_t gap = Hw_core.cycles - HwSim.wdtClear;
+    return (gap > HwSim.wdtLongestGap) ? gap : HwSim.wdtLongestGap;
+}
+
+/**
+ * @brief Gets the number of watchdog clears that came after the watchdog period, the target would have reset
+ *
+ * @return uint32_t The number of time outs
+ */
+uint32_t HwSim_GetWatchdogTimeouts(void)
+{
+    return HwSim.wdtTimeouts;
+}
+
+/**
+ * @brief Sets the handler that is called when the run time elapses, it must not return
+ *
+ * @param hook The handler
+ */
+void HwSim_SetStopHandler(HwSim_Hook_t hook)
+{
+    HwSim.stopHandler = hook;
+}
+
+/**
+ * @brief Sets a hook that is called on every CCP1 compare event
+ *
+ * @param hook The hook
+ */
+void HwSim_SetTickHook(HwSim_Hook_t hook)
+{
+    HwSim.tickHook = hook;
+}
+
+/**
+ * @brief Sets the source of the analog inputs
+ *
+ * @param source Returns a 10-bit sample for a channel
+ */
+void HwSim_SetAdcSource(HwSim_AdcSource_t source)
+{
+    HwSim.adcSource = source;
+}
+
+/**
+ * @brief Drives the external level of input pins
+ *
+ * @param port The port
+ * @param pins The pins mask
+ * @param level The level (0/1)
+ */
+void HwSim_SetPins(uint8_t port, uint8_t pins, uint8_t level)
+{
+    if(level)
+    {
+        HwSim.pinLevel[HW_SIM_PORT_INDEX(port)] |= pins;
+    }
+    else
+    {
+        HwSim.pinLevel[HW_SIM_PORT_INDEX(port)] &= (uint8_t)~pins;
+    }
+    HwSim_UpdatePort(port);
+}
+
+/**
+ * @brief Gets the pins that are configured as outputs and driven high
+ *
+ * @param port The port
+ * @return uint8_t The pins mask
+ */
+uint8_t HwSim_GetOutputs(uint8_t port)
+{
+    return (uint8_t)(HwSim.latch[HW_SIM_PORT_INDEX(port)] & ~Hw_core.reg[port + HW_SIM_TRIS_OFFSET]);
+}
+
+/**
+ * @brief Reads a byte from the simulated EEPROM without using the bus
+ *
+ * @param address The EEPROM address
+ * @return uint8_t The data
+ */
+uint8_t HwSim_GetEepromByte(uint16_t address)
+{
+    return HwSim.eeprom[address & (HW_SIM_EEPROM_SIZE - 1)];
+}
+
+/**
+ * @brief Makes the EEPROM refuse the next page writes, it does not acknowledge their first data byte
+ *        and nothing is written, like a device that is still busy or failing
+ *
+ * @param writes The number of page writes to refuse
+ */
+void HwSim_SetEepromWriteFaults(uint32_t writes)
+{
+    HwSim.eepromWriteFaults = writes;
+}
+
+/**
+ * @brief Prints a summary of the run and ends the process
+ *
+ */
+static void HwSim_DefaultStop(void)
+{
+    printf("simulated time      : %.3f s\n", (f64)Hw_core.cycles / (f64)HW_SIM_CYCLES_PER_SECOND);
+    printf("CCP1 compare events : %llu\n", (unsigned long long)HwSim.ticks);
+    printf("idle                : %.1f %%\n", Hw_core.cycles ? 100.0 * (f64)HwSim.idleCycles / (f64)Hw_core.cycles : 0.0);
+    printf("asleep              : %.1f %%\n", Hw_core.cycles ? 100.0 * (f64)HwSim.sleepCycles / (f64)Hw_core.cycles : 0.0);
+    printf("PORTC outputs       : 0x%02X\n", HwSim_GetOutputs(HW_SIM_PORTC));
+    printf("EEPROM[0x0000]      : %u\n", HwSim.eeprom[0]);
+    exit(EXIT_SUCCESS);
+}
@@ -0,0 +1,363 @@
+/**
+ * @file Offsets.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The planner of the first delays of the configured tasks, the execution times are measured by the
+ *        scheduler instrumentation on a simulated run, then every periodic task gets the phase in its period
+ *        that keeps the peak work of a tick over the hyperperiod as low as possible, the periods are not changed
+ *
+ *        The tasks are placed from the longest down, each on the phase with the lowest peak, then the lowest sum
+ *        of the squared tick loads, then the nearest phase from the configured one on, then the tasks are moved
+ *        one at a time while it lowers the peak or the sum of squares. The per-tick load profile of the configured
+ *        and planned delays is printed with the first delays to put in Sched_Cfg.c
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Std_Types.h"
+#include "Hw.h"
+#include "Sched_Cfg.h"
+#include "Sim.h"
+#include "Offsets_Cfg.h"
+
+#if SCHED_INSTRUMENTATION != STD_ON
+#error "The offset planner needs SCHED_INSTRUMENTATION"
+#endif
+
+#define OFFSETS_SECONDS_PER_DAY           86400.0
+
+/* Loads Closer Than This Are Equal, They Are Sums Of The Same Measured Times */
+#define OFFSETS_EPSILON_US                1e-6
+
+typedef struct
+{
+    const char* name;
+    uint32_t periodTicks;
+    uint32_t delayTicks;
+    f64 execUS;
+    /* The Tick Of The Hyperperiod That Runs The Task First, The First Delay Modulo The Period */
+    uint32_t configuredPhase;
+    uint32_t phase;
+    /* The Initialization Task, The Free Slots And The Tasks That Never Ran Are Not Planned */
+    uint8_t planned;
+    uint8_t placed;
+} offsetsTask_t;
+
+static offsetsTask_t Offsets_task[SCHED_NUMBER_OF_TASKS];
+static f64 Offsets_configuredLoad[OFFSETS_MAX_HYPERPERIOD_TICKS];
+static f64 Offsets_plannedLoad[OFFSETS_MAX_HYPERPERIOD_TICKS];
+static uint32_t Offsets_hyperperiod;
+static simScenario_t Offsets_scenario;
+static f64 Offsets_marginPercent = OFFSETS_DEFAULT_MARGIN_PERCENT;
+
+/**
+ * @brief Gets the greatest common divisor of two periods
+ *
+ */
+static uint32_t Offsets_Gcd(uint32_t a, uint32_t b)
+{
+    uint32_t rest;
+    while(b)
+    {
+        rest = a % b;
+        a = b;
+        b = rest;
+    }
+    return a;
+}
+
+/**
+ * @brief Adds or removes the work of a task on every tick of the hyperperiod that runs it
+ *
+ * @param load The per-tick load profile
+ * @param task The task index
+ * @param phase The first tick of the task in the hyperperiod
+ * @param sign 1.0 to add the task, -1.0 to remove it
+ */
+static void Offsets_Place(f64* load, uint8_t task, uint32_t phase, f64 sign)
+{
+    uint32_t tick;
+    for(tick=phase; tick<Offsets_hyperperiod; tick+=Offsets_task[task].periodTicks)
+    {
+        load[tick] += sign * Offsets_task[task].execUS;
+    }
+}
+
+/**
+ * @brief Gets the peak and the sum of the squared tick loads of a profile
+ *
+ */
+static void Offsets_Measure(const f64* load, f64* peak, f64* squares)
+{
+    uint32_t tick;
+    *peak = 0.0;
+    *squares = 0.0;
+    for(tick=0; tick<Offsets_hyperperiod; tick++)
+    {
+        if(load[tick] > *peak)
+        {
+            *peak = load[tick];
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        *squares += load[tick] * load[tick];
+    }
+}
+
+/**
+ * @brief Places a task that is not in the planned profile on its best phase
+ *
+ * @param task The task index
+ * @param preferred The phase kept when the others are not better
+ */
+static void Offsets_PlaceBest(uint8_t task, uint32_t preferred)
+{
+    uint32_t step;
+    uint32_t phase;
+    uint32_t best = preferred;
+    f64 peak;
+    f64 squares;
+    f64 bestPeak;
+    f64 bestSquares;
+    Offsets_Place(Offsets_plannedLoad, task, preferred, 1.0);
+    Offsets_Measure(Offsets_plannedLoad, &bestPeak, &bestSquares);
+    Offsets_Place(Offsets_plannedLoad, task, preferred, -1.0);
+    /* The Phases Are Tried From The Preferred One On, An Equal Load Keeps The Nearest Later Phase */
+    for(step=1; step<Offsets_task[task].periodTicks; step++)
+    {
+        phase = (preferred + step) % Offsets_task[task].periodTicks;
+        Offsets_Place(Offsets_plannedLoad, task, phase, 1.0);
+        Offsets_Measure(Offsets_plannedLoad, &peak, &squares);
+        Offsets_Place(Offsets_plannedLoad, task, phase, -1.0);
+        if(peak < bestPeak - OFFSETS_EPSILON_US ||
+           (peak < bestPeak + OFFSETS_EPSILON_US && squares < bestSquares - OFFSETS_EPSILON_US))
+        {
+            best = phase;
+            bestPeak = peak;
+            bestSquares = squares;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    Offsets_task[task].phase = best;
+    Offsets_task[task].placed = 1;
+    Offsets_Place(Offsets_plannedLoad, task, best, 1.0);
+}
+
+/**
+ * @brief Places the tasks from the longest down, then moves them one at a time until no move lowers the load
+ *
+ */
+static void Offsets_Plan(void)
+{
+    uint8_t i;
+    uint8_t next;
+    uint8_t moved = 1;
+    uint16_t pass;
+    uint32_t phase;
+    do
+    {
+        next = SCHED_NUMBER_OF_TASKS;
+        for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
+        {
+            if(Offsets_task[i].planned && !Offsets_task[i].placed &&
+               (SCHED_NUMBER_OF_TASKS == next || Offsets_task[i].execUS > Offsets_task[next].execUS))
+            {
+                next = i;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+        if(next < SCHED_NUMBER_OF_TASKS)
+        {
+            Offsets_PlaceBest(next, Offsets_task[next].configuredPhase);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    } while(next < SCHED_NUMBER_OF_TASKS);
+    for(pass=0; pass<OFFSETS_MAX_PASSES && moved; pass++)
+    {
+        moved = 0;
+        for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
+        {
+            if(Offsets_task[i].planned)
+            {
+                /* A Task Only Moves When The Load Gets Strictly Lower, So The Passes End */
+                phase = Offsets_task[i].phase;
+                Offsets_Place(Offsets_plannedLoad, i, phase, -1.0);
+                Offsets_PlaceBest(i, phase);
+                moved |= Offsets_task[i].phase != phase;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+    }
+}
+
+/**
+ * @brief Gets the first delay of a phase, the phase 0 is moved one period later so the tasks
+ *        do not start on the tick of the initialization task
+ *
+ */
+static uint32_t Offsets_Delay(uint8_t task)
+{
+    uint32_t delay = Offsets_task[task].phase;
+    if(0 == delay && Offsets_task[task].periodTicks < SCHED_MAX_TICKS)
+    {
+        delay = Offsets_task[task].periodTicks;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return delay;
+}
+
+/**
+ * @brief Plans the first delays with the measured execution times, prints them and ends the process
+ *        The exit status is EXIT_FAILURE if the hyperperiod is too long to plan
+ *
+ */
+static void Offsets_Report(void)
+{
+    simResult_t result;
+    schedTaskStats_t stats;
+    sysTaskInfo_t info;
+    f64 usPerCount = 1e6 / (f64)SCHED_SYS_CLK;
+    f64 configuredPeak;
+    f64 plannedPeak;
+    f64 squares;
+    uint32_t tick;
+    uint32_t divisor;
+    uint8_t i;
+    Sim_GetResult(&result);
+    Offsets_hyperperiod = 1;
+    for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
+    {
+        /* The Initialization Task Is The Only Task That Runs Once With Its First Delay Of 0 */
+        if(Sched_GetTaskInfo(i, &info) == E_OK && Sched_GetTaskStats(info.task, &stats) == E_OK &&
+           stats.runs > 0 && !(stats.runs == 1 && info.delayTicks == 0))
+        {
+            Offsets_task[i].name = Sim_GetTaskName(info.task);
+            Offsets_task[i].periodTicks = info.periodTicks;
+            Offsets_task[i].delayTicks = info.delayTicks;
+            Offsets_task[i].configuredPhase = info.delayTicks % info.periodTicks;
+            Offsets_task[i].execUS = stats.maxExecCounts * usPerCount * (1.0 + Offsets_marginPercent / 100.0);
+            Offsets_task[i].planned = 1;
+            divisor = Offsets_Gcd(Offsets_hyperperiod, info.periodTicks);
+            if(Offsets_hyperperiod / divisor > OFFSETS_MAX_HYPERPERIOD_TICKS / info.periodTicks)
+            {
+                fprintf(stderr, "the hyperperiod is longer than %lu ticks\n", (unsigned long)OFFSETS_MAX_HYPERPERIOD_TICKS);
+                exit(EXIT_FAILURE);
+            }
+            else
+            {
+                Offsets_hyperperiod = Offsets_hyperperiod / divisor * info.periodTicks;
+            }
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
+    {
+        if(Offsets_task[i].planned)
+        {
+            Offsets_Place(Offsets_configuredLoad, i, Offsets_task[i].configuredPhase, 1.0);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    Offsets_Plan();
+    Offsets_Measure(Offsets_configuredLoad, &configuredPeak, &squares);
+    Offsets_Measure(Offsets_plannedLoad, &plannedPeak, &squares);
+    printf("measured over       : %.1f s (%.0f %% margin on the longest execution times)\n", result.simulatedS, Offsets_marginPercent);
+    printf("hyperperiod         : %lu ticks (%lu ms)\n", (unsigned long)Offsets_hyperperiod,
+           (unsigned long)(Offsets_hyperperiod * SCHED_TICK_TIME_MS));
+    printf("peak tick load      : %.1f us configured, %.1f us planned\n", configuredPeak, plannedPeak);
+    printf("task              period (ticks)  C (us)  configured delay  planned delay\n");
+    for(i=0; i<SCHED_NUMBER_OF_TASKS; i++)
+    {
+        if(Offsets_task[i].planned)
+        {
+            printf("%-16s  %14lu  %6.1f  %16lu  %13lu\n", Offsets_task[i].name, (unsigned long)Offsets_task[i].periodTicks,
+                   Offsets_task[i].execUS, (unsigned long)Offsets_task[i].delayTicks, (unsigned long)Offsets_Delay(i));
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    printf("tick  configured (us)  planned (us)\n");
+    for(tick=0; tick<Offsets_hyperperiod; tick++)
+    {
+        printf("%4lu  %15.1f  %12.1f\n", (unsigned long)tick, Offsets_configuredLoad[tick], Offsets_plannedLoad[tick]);
+    }
+    exit(EXIT_SUCCESS);
+}
+
+/**
+ * @brief Measures the execution times on the default scenario and plans the first delays
+ *          -t <seconds> : The simulated run time
+ *          -d <days>    : The simulated run time in days
+ *          -m <percent> : The margin added to the measured execution times
+ *
+ */
+int main(int argc, char* argv[])
+{
+    int i;
+    Sim_GetDefaults(&Offsets_scenario);
+    Offsets_scenario.runTimeS = OFFSETS_DEFAULT_RUN_TIME_S;
+    /* Change The Setpoint And Switch The Heater Off And On So The Save And Load Paths Are Measured */
+    Offsets_scenario.setpointC = OFFSETS_SETPOINT_C;
+    Offsets_scenario.restartAtS = OFFSETS_RESTART_S;
+    for(i=1; i<argc; i++)
+    {
+        if(i + 1 < argc && strcmp(argv[i], "-t") == 0)
+        {
+            Offsets_scenario.runTimeS = atof(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-d") == 0)
+        {
+            Offsets_scenario.runTimeS = atof(argv[++i]) * OFFSETS_SECONDS_PER_DAY;
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-m") == 0)
+        {
+            Offsets_marginPercent = atof(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-t seconds] [-d days] [-m margin percent]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if(Sim_Start(&Offsets_scenario, Offsets_Report) != E_OK)
+    {
+        fprintf(stderr, "%s: the scenario is not valid\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    Sched_Init();
+    Sched_Start();
+    return 0;
+}
@@ -0,0 +1,282 @@
+/**
+ * @file Plant.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The simulated water tank, it is heated and cooled by the elements and read by the ADC
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <string.h>
+#include "Std_Types.h"
+#include "HwSim_Cfg.h"
+#include "Hw.h"
+#include "HwSim.h"
+#include "Plant.h"
+
+/* The Heat Capacity Of Water (J/L/K) */
+#define PLANT_WATER_J_PER_L_K             4186.0
+#define PLANT_SECONDS_PER_DAY             86400.0
+#define PLANT_ADC_MAX                     1023.0
+
+typedef struct
+{
+    const plantParams_t* params;
+    plantState_t state;
+    uint64_t lastCycles;
+    /* The Tank Sensor Spikes Until This Cycle */
+    uint64_t glitchEndCycles;
+    uint8_t heaterOn;
+    uint8_t coolerOn;
+    uint8_t ticks;
+    uint32_t random;
+} plant_t;
+
+static HW_INSTANCE plant_t Plant;
+
+/**
+ * @brief A small xorshift generator for the sensor noise
+ *
+ */
+static f64 Plant_Noise(void)
+{
+    Plant.random ^= Plant.random << 13;
+    Plant.random ^= Plant.random >> 17;
+    Plant.random ^= Plant.random << 5;
+    return ((f64)Plant.random / 4294967296.0 - 0.5) * 2.0 * Plant.params->noiseCounts;
+}
+
+/**
+ * @brief Converts a temperature to ADC counts
+ *
+ */
+static uint16_t Plant_ToCounts(f64 temperatureC)
+{
+    f64 counts = temperatureC * Plant.params->countsPerC + Plant_Noise() + 0.5;
+    if(counts < 0.0)
+    {
+        counts = 0.0;
+    }
+    else if(counts > PLANT_ADC_MAX)
+    {
+        counts = PLANT_ADC_MAX;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return (uint16_t)counts;
+}
+
+/**
+ * @brief Checks whether an element output changed since the tank was last stepped
+ *
+ */
+static uint8_t Plant_Switched(void)
+{
+    uint8_t outputs = (uint8_t)((HwSim_GetOutputs(PLANT_HEATER_PORT) & PLANT_HEATER_PIN) | (HwSim_GetOutputs(PLANT_COOLER_PORT) & PLANT_COOLER_PIN));
+    uint8_t last = (uint8_t)((Plant.heaterOn ? PLANT_HEATER_PIN : 0) | (Plant.coolerOn ? PLANT_COOLER_PIN : 0));
+    return outputs != last;
+}
+
+/**
+ * @brief The analog source of the simulator, the tank is only stepped here when an element switched
+ *        so the sensor glitch starts with the switch, otherwise the tick steps are fine enough
+ *
+ */
+static uint16_t Plant_ReadChannel(uint8_t channel)
+{
+    f64 temperatureC;
+    if(Plant_Switched())
+    {
+        Plant_Step();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(channel == PLANT_SENSOR_CHANNEL)
+    {
+        temperatureC = Plant.state.temperatureC;
+        if(HwSim_GetCycles() < Plant.glitchEndCycles)
+        {
+            temperatureC += Plant.params->glitchCounts / Plant.params->countsPerC;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    else
+    {
+        temperatureC = Plant.params->ambientC;
+    }
+    return Plant_ToCounts(temperatureC);
+}
+
+/**
+ * @brief The draw-off flow at a time of the day
+ *
+ */
+static f64 Plant_DrawFlow(f64 timeS)
+{
+    f64 dayS = timeS - PLANT_SECONDS_PER_DAY * (f64)(uint64_t)(timeS / PLANT_SECONDS_PER_DAY);
+    f64 flow = 0.0;
+    uint8_t i;
+    for(i=0; i<Plant.params->numberOfDraws; i++)
+    {
+        if(dayS >= Plant.params->draws[i].startS && dayS < Plant.params->draws[i].startS + Plant.params->draws[i].durationS)
+        {
+            flow += Plant.params->draws[i].litresPerMin / 60.0;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return flow;
+}
+
+/**
+ * @brief Fills the parameters with the default tank and draw-off profile
+ *
+ * @param params The parameters
+ */
+void Plant_GetDefaults(plantParams_t* params)
+{
+    static const plantDraw_t draws[] = {
+        /* Morning Shower */
+        {7.0 * 3600.0,  600.0, 8.0},
+        /* Lunch Dishes */
+        {13.0 * 3600.0, 120.0, 5.0},
+        /* Evening Bath */
+        {19.5 * 3600.0, 480.0, 10.0}
+    };
+    memset(params, 0, sizeof(*params));
+    params->volumeL = PLANT_DEFAULT_VOLUME_L;
+    params->heaterW = PLANT_DEFAULT_HEATER_W;
+    params->coolerW = PLANT_DEFAULT_COOLER_W;
+    params->lossWPerK = PLANT_DEFAULT_LOSS_W_PER_K;
+    params->ambientC = PLANT_DEFAULT_AMBIENT_C;
+    params->inletC = PLANT_DEFAULT_INLET_C;
+    params->initialC = PLANT_DEFAULT_INITIAL_C;
+    params->countsPerC = PLANT_DEFAULT_COUNTS_PER_C;
+    params->noiseCounts = PLANT_DEFAULT_NOISE_COUNTS;
+    params->glitchCounts = PLANT_DEFAULT_GLITCH_COUNTS;
+    params->glitchS = PLANT_DEFAULT_GLITCH_S;
+    params->numberOfDraws = sizeof(draws) / sizeof(draws[0]);
+    memcpy(params->draws, draws, sizeof(draws));
+    params->seed = 1;
+}
+
+/**
+ * @brief Attaches the tank to the simulator, the ADC reads the tank and the elements heat it
+ *        The owner of the CCP1 tick hook calls Plant_Tick on every tick
+ *
+ * @param params The parameters, they must stay valid while the simulation runs
+ */
+void Plant_Init(const plantParams_t* params)
+{
+    memset(&Plant, 0, sizeof(Plant));
+    Plant.params = params;
+    Plant.state.temperatureC = params->initialC;
+    Plant.random = params->seed ? params->seed : 1;
+    Plant.lastCycles = HwSim_GetCycles();
+    HwSim_SetAdcSource(Plant_ReadChannel);
+}
+
+/**
+ * @brief Advances the tank to the current simulated time
+ *
+ */
+void Plant_Step(void)
+{
+    uint64_t cycles = HwSim_GetCycles();
+    f64 dt = (f64)(cycles - Plant.lastCycles) / (f64)HW_SIM_CYCLES_PER_SECOND;
+    f64 capacity = Plant.params->volumeL * PLANT_WATER_J_PER_L_K;
+    f64 power;
+    f64 drawnL;
+    uint8_t heaterOn = (HwSim_GetOutputs(PLANT_HEATER_PORT) & PLANT_HEATER_PIN) != 0;
+    uint8_t coolerOn = (HwSim_GetOutputs(PLANT_COOLER_PORT) & PLANT_COOLER_PIN) != 0;
+    Plant.lastCycles = cycles;
+    /* Count The Element Switching */
+    Plant.state.heaterSwitches += heaterOn != Plant.heaterOn;
+    Plant.state.coolerSwitches += coolerOn != Plant.coolerOn;
+    if(heaterOn != Plant.heaterOn || coolerOn != Plant.coolerOn)
+    {
+        Plant.glitchEndCycles = cycles + (uint64_t)(Plant.params->glitchS * (f64)HW_SIM_CYCLES_PER_SECOND);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    Plant.heaterOn = heaterOn;
+    Plant.coolerOn = coolerOn;
+    /* Heat Balance Of The Tank */
+    power = -Plant.params->lossWPerK * (Plant.state.temperatureC - Plant.params->ambientC);
+    if(heaterOn)
+    {
+        power += Plant.params->heaterW;
+        Plant.state.heaterJ += Plant.params->heaterW * dt;
+        Plant.state.heaterOnS += dt;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(coolerOn)
+    {
+        power -= Plant.params->coolerW;
+        Plant.state.coolerJ += Plant.params->coolerW * dt;
+        Plant.state.coolerOnS += dt;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    Plant.state.temperatureC += power * dt / capacity;
+    /* Drawn Water Is Replaced By Cold Inlet Water */
+    drawnL = Plant_DrawFlow((f64)cycles / (f64)HW_SIM_CYCLES_PER_SECOND) * dt;
+    if(drawnL > 0.0)
+    {
+        Plant.state.temperatureC += (drawnL / Plant.params->volumeL) * (Plant.params->inletC - Plant.state.temperatureC);
+        Plant.state.drawnL += drawnL;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Called on every CCP1 tick, the tank is only integrated when an element switched
+ *        or PLANT_STEP_TICKS passed since the tank thermal time constant is hours long
+ *
+ * @return uint8_t 1 if the tank was stepped
+ */
+uint8_t Plant_Tick(void)
+{
+    uint8_t stepped = 0;
+    if(Plant_Switched() || ++Plant.ticks >= PLANT_STEP_TICKS)
+    {
+        Plant.ticks = 0;
+        Plant_Step();
+        stepped = 1;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return stepped;
+}
+
+/**
+ * @brief Gets the tank state
+ *
+ * @return const plantState_t* The state
+ */
+const plantState_t* Plant_GetState(void)
+{
+    return &Plant.state;
+}
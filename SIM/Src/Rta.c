@@ -0,0 +1,271 @@
+/**
+ * @file Rta.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The worst case response time analysis of the configured task set, the execution times are
+ *        measured by the scheduler instrumentation on a simulated run and the priorities, contexts
+ *        and periods are taken from Sched_Cfg.c and the created tasks, a one shot task is analysed with
+ *        its period as the shortest time between two runs
+ *
+ *        The scan is not preemptive, a scan task waits for the lower priority task that just started,
+ *        the higher priority scan tasks released before it starts and the interrupt context tasks and
+ *        the scheduler overhead that preempt it:
+ *            w = B + sum(hp scan)(floor(w / T) + 1) * C + sum(isr)(ceil((w + C) / T) * C) + ceil((w + C) / tick) * O
+ *            R = w + C
+ *        An interrupt context task waits for the scheduler overhead and the higher priority interrupt context tasks
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "Std_Types.h"
+#include "Hw.h"
+#include "Sched_Cfg.h"
+#include "Sim.h"
+#include "Rta_Cfg.h"
+
+#if SCHED_INSTRUMENTATION != STD_ON
+#error "The response time analysis needs SCHED_INSTRUMENTATION"
+#endif
+
+#define RTA_SECONDS_PER_DAY               86400.0
+
+typedef struct
+{
+    const char* name;
+    uint8_t priority;
+    uint8_t context;
+    /* A Task That Ran Once Is An Initialization Task, It Runs Before The Periodic Tasks Start */
+    uint8_t oneShot;
+    f64 periodUS;
+    f64 execUS;
+    f64 blockingUS;
+    f64 responseUS;
+    uint8_t met;
+    /* A Free Task Slot Or A Task That Never Ran */
+    uint8_t skipped;
+} rtaTask_t;
+
+static rtaTask_t Rta_task[SCHED_MAX_TASKS];
+static simScenario_t Rta_scenario;
+static f64 Rta_marginPercent = RTA_DEFAULT_MARGIN_PERCENT;
+
+/**
+ * @brief Checks if a task runs before another task, equal priorities keep the table order like the scheduler
+ *
+ */
+static uint8_t Rta_IsHigher(uint8_t task, uint8_t other)
+{
+    return Rta_task[task].priority > Rta_task[other].priority ||
+           (Rta_task[task].priority == Rta_task[other].priority && task < other);
+}
+
+/**
+ * @brief Solves the response time of a task
+ *
+ * @param task The task index
+ * @param overheadUS The scheduler overhead of one wake-up
+ */
+static void Rta_Solve(uint8_t task, f64 overheadUS)
+{
+    rtaTask_t* item = &Rta_task[task];
+    f64 tickUS = SCHED_TICK_TIME_MS * 1000.0;
+    f64 w;
+    f64 next = 0.0;
+    uint8_t i;
+    uint16_t iteration;
+    item->blockingUS = 0.0;
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        /* A Lower Priority Scan Task Can Not Be Interrupted By The Scan Once It Started */
+        if(i != task && !Rta_task[i].oneShot && !Rta_task[i].skipped && SCHED_CONTEXT_TASK == item->context &&
+           SCHED_CONTEXT_TASK == Rta_task[i].context && Rta_IsHigher(task, i) && Rta_task[i].execUS > item->blockingUS)
+        {
+            item->blockingUS = Rta_task[i].execUS;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    w = item->blockingUS;
+    for(iteration=0; iteration<RTA_MAX_ITERATIONS; iteration++)
+    {
+        next = item->blockingUS + ceil((w + item->execUS) / tickUS) * overheadUS;
+        for(i=0; i<SCHED_MAX_TASKS; i++)
+        {
+            if(i == task || Rta_task[i].oneShot || Rta_task[i].skipped)
+            {
+                /* The Task Itself, The Initialization Tasks And The Free Slots Do Not Interfere */
+            }
+            else if(SCHED_CONTEXT_ISR == item->context)
+            {
+                /* The Interrupt Runs Its Tasks Once Per Match In The Priority Order */
+                next += (SCHED_CONTEXT_ISR == Rta_task[i].context && Rta_IsHigher(i, task)) ? Rta_task[i].execUS : 0.0;
+            }
+            else if(SCHED_CONTEXT_ISR == Rta_task[i].context)
+            {
+                next += ceil((w + item->execUS) / Rta_task[i].periodUS) * Rta_task[i].execUS;
+            }
+            else if(Rta_IsHigher(i, task))
+            {
+                next += (floor(w / Rta_task[i].periodUS) + 1.0) * Rta_task[i].execUS;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+        if(next == w || next + item->execUS > item->periodUS)
+        {
+            break;
+        }
+        else
+        {
+            w = next;
+        }
+    }
+    item->responseUS = next + item->execUS;
+    item->met = item->responseUS <= item->periodUS;
+}
+
+/**
+ * @brief Analyses the task set with the measured execution times, prints it and ends the process
+ *        The exit status is EXIT_FAILURE if a deadline is missed
+ *
+ */
+static void Rta_Report(void)
+{
+    simResult_t result;
+    schedTaskStats_t stats;
+    sysTaskInfo_t info;
+    f64 usPerCount = 1e6 / (f64)SCHED_SYS_CLK;
+    f64 busyUS;
+    f64 tasksUS = 0.0;
+    f64 overheadUS;
+    f64 utilization;
+    uint8_t i;
+    uint8_t missed = 0;
+    Sim_GetResult(&result);
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(Sched_GetTaskInfo(i, &info) == E_OK && Sched_GetTaskStats(info.task, &stats) == E_OK && stats.runs > 0)
+        {
+            Rta_task[i].name = Sim_GetTaskName(info.task);
+            Rta_task[i].priority = info.priority;
+            Rta_task[i].context = (SCHED_ISR_TASKS == STD_ON) ? info.context : SCHED_CONTEXT_TASK;
+            Rta_task[i].periodUS = info.task->periodicTimeMS * 1000.0;
+            /* The Initialization Task Is The Only Task That Runs Once With Its First Delay Of 0 */
+            Rta_task[i].oneShot = stats.runs == 1 && info.delayTicks == 0 && i < SCHED_NUMBER_OF_TASKS;
+            Rta_task[i].execUS = stats.maxExecCounts * usPerCount * (1.0 + Rta_marginPercent / 100.0);
+            tasksUS += (f64)stats.runs * stats.avgExecCounts * usPerCount;
+        }
+        else
+        {
+            Rta_task[i].skipped = 1;
+        }
+    }
+    /* The Busy Time That Was Not Spent In The Runnables Is The Interrupt And Scan Overhead */
+    busyUS = result.simulatedS * 1e6 * (1.0 - result.idlePercent / 100.0);
+    overheadUS = result.wakeUps ? (busyUS - tasksUS) / (f64)result.wakeUps * (1.0 + Rta_marginPercent / 100.0) : 0.0;
+    if(overheadUS < 0.0)
+    {
+        overheadUS = 0.0;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    utilization = overheadUS / (SCHED_TICK_TIME_MS * 1000.0);
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(!Rta_task[i].oneShot && !Rta_task[i].skipped)
+        {
+            utilization += Rta_task[i].execUS / Rta_task[i].periodUS;
+            Rta_Solve(i, overheadUS);
+            missed += !Rta_task[i].met;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    printf("measured over       : %.1f s (%.0f %% margin on the longest execution times)\n", result.simulatedS, Rta_marginPercent);
+    printf("scheduler overhead  : %.1f us per wake-up\n", overheadUS);
+    printf("utilization         : %.2f %%\n", utilization * 100.0);
+    printf("task              context  prio  period (ms)  C (us)   B (us)   R (us)  deadline\n");
+    for(i=0; i<SCHED_MAX_TASKS; i++)
+    {
+        if(Rta_task[i].skipped)
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        else if(Rta_task[i].oneShot)
+        {
+            printf("%-16s  %-7s  %4u  %11s  %6.1f  %7s  %7s  %s\n", Rta_task[i].name,
+                   SCHED_CONTEXT_ISR == Rta_task[i].context ? "isr" : "scan", Rta_task[i].priority, "once",
+                   Rta_task[i].execUS, "-", "-", "before the periodic tasks");
+        }
+        else
+        {
+            printf("%-16s  %-7s  %4u  %11.1f  %6.1f  %7.1f  %7.1f  %s\n", Rta_task[i].name,
+                   SCHED_CONTEXT_ISR == Rta_task[i].context ? "isr" : "scan", Rta_task[i].priority,
+                   Rta_task[i].periodUS / 1000.0, Rta_task[i].execUS, Rta_task[i].blockingUS, Rta_task[i].responseUS,
+                   Rta_task[i].met ? "met" : "MISSED");
+        }
+    }
+    exit(missed ? EXIT_FAILURE : EXIT_SUCCESS);
+}
+
+/**
+ * @brief Measures the execution times on the default scenario and analyses the task set
+ *          -t <seconds> : The simulated run time
+ *          -d <days>    : The simulated run time in days
+ *          -m <percent> : The margin added to the measured execution times
+ *
+ */
+int main(int argc, char* argv[])
+{
+    int i;
+    Sim_GetDefaults(&Rta_scenario);
+    Rta_scenario.runTimeS = RTA_DEFAULT_RUN_TIME_S;
+    /* Change The Setpoint And Switch The Heater Off And On So The Save And Load Paths Are Measured */
+    Rta_scenario.setpointC = RTA_SETPOINT_C;
+    Rta_scenario.restartAtS = RTA_RESTART_S;
+    for(i=1; i<argc; i++)
+    {
+        if(i + 1 < argc && strcmp(argv[i], "-t") == 0)
+        {
+            Rta_scenario.runTimeS = atof(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-d") == 0)
+        {
+            Rta_scenario.runTimeS = atof(argv[++i]) * RTA_SECONDS_PER_DAY;
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-m") == 0)
+        {
+            Rta_marginPercent = atof(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-t seconds] [-d days] [-m margin percent]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    if(Sim_Start(&Rta_scenario, Rta_Report) != E_OK)
+    {
+        fprintf(stderr, "%s: the scenario is not valid\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    Sched_Init();
+    Sched_Start();
+    return 0;
+}
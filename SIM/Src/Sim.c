@@ -0,0 +1,550 @@
+/**
+ * @file Sim.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The closed loop simulation of the firmware and the water tank
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "Std_Types.h"
+#include "Hw.h"
+#include "HwSim_Cfg.h"
+#include "Sched_Cfg.h"
+#include "Sim.h"
+#include "I2c.h"
+#include "Eeprom.h"
+#include "Settings.h"
+
+#define SIM_SECONDS_PER_DAY               86400.0
+/* The Settings Records Are Checked Here Apart From The Firmware, The Sequence Number Is In The First
+ * Two Bytes, The Values Follow And The Last Byte Is A CRC-8 Of SAE J1850 Of The Others */
+#define SIM_RECORD_SEQUENCE               0
+#define SIM_RECORD_VALUES                 2
+#define SIM_RECORD_ERASED                 0xFFFF
+#define SIM_CRC_POLYNOMIAL                0x1D
+#define SIM_CRC_INITIAL                   0xFF
+#define SIM_CRC_FINAL                     0xFF
+
+extern const task_t WaterHeater_InitTask;
+extern const task_t WaterHeater_Task;
+extern const task_t WaterHeater_SaveTask;
+extern const task_t SSeg_task;
+extern const task_t Switch_task;
+extern const task_t AdcSeq_task;
+
+#if SCHED_INSTRUMENTATION == STD_ON
+typedef struct
+{
+    const task_t* task;
+    const char* name;
+} simTaskName_t;
+
+/* The Tasks Of Sched_Cfg.c And The Created Tasks */
+static const simTaskName_t Sim_tasks[] = {
+    {&WaterHeater_InitTask, "WaterHeater_Init"},
+    {&Switch_task,          "Switch"},
+    {&WaterHeater_Task,     "WaterHeater"},
+    {&SSeg_task,            "SSeg"},
+    {&AdcSeq_task,          "AdcSeq"},
+    {&WaterHeater_SaveTask, "WaterHeater_Save"}
+};
+#endif
+
+typedef struct
+{
+    uint64_t atCycles;
+    uint8_t button;
+    uint8_t level;
+} simPinEvent_t;
+
+typedef struct
+{
+    const simScenario_t* scenario;
+    simResult_t result;
+    simPinEvent_t events[2 * SIM_MAX_PRESSES];
+    uint8_t numberOfEvents;
+    uint8_t nextEvent;
+    uint8_t inBand;
+    uint64_t lastCycles;
+    /* The Setpoint The Buttons Step To */
+    sint16_t enteredC;
+} sim_t;
+
+static HW_INSTANCE sim_t Sim;
+static HW_INSTANCE simScenario_t Sim_scenario;
+static HW_INSTANCE clock_t Sim_wallStart;
+
+/**
+ * @brief Converts seconds to instruction cycles
+ *
+ */
+static uint64_t Sim_Cycles(f64 seconds)
+{
+    return (uint64_t)(seconds * (f64)HW_SIM_CYCLES_PER_SECOND);
+}
+
+/**
+ * @brief Queues a button press and its release
+ *
+ */
+static void Sim_Press(f64 atS, uint8_t button)
+{
+    if(Sim.numberOfEvents < 2 * SIM_MAX_PRESSES)
+    {
+        Sim.events[Sim.numberOfEvents++] = (simPinEvent_t){Sim_Cycles(atS), button, 0};
+        Sim.events[Sim.numberOfEvents++] = (simPinEvent_t){Sim_Cycles(atS + SIM_PRESS_S), button, 1};
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Called on every CCP1 compare event, steps the tank, the buttons and the scores
+ *
+ */
+static void Sim_Tick(void)
+{
+    uint64_t cycles = HwSim_GetCycles();
+    f64 dt;
+    f64 temperatureC;
+    f64 errorC;
+    /* Buttons */
+    while(Sim.nextEvent < Sim.numberOfEvents && Sim.events[Sim.nextEvent].atCycles <= cycles)
+    {
+        HwSim_SetPins(SIM_BUTTON_PORT, Sim.events[Sim.nextEvent].button, Sim.events[Sim.nextEvent].level);
+        Sim.nextEvent++;
+    }
+    /* Scores, Only When The Tank Moved */
+    if(Plant_Tick())
+    {
+        dt = (f64)(cycles - Sim.lastCycles) / (f64)HW_SIM_CYCLES_PER_SECOND;
+        Sim.lastCycles = cycles;
+        temperatureC = Plant_GetState()->temperatureC;
+        if(temperatureC < Sim.result.minC)
+        {
+            Sim.result.minC = temperatureC;
+        }
+        if(temperatureC > Sim.result.maxC)
+        {
+            Sim.result.maxC = temperatureC;
+        }
+        errorC = temperatureC - (f64)Sim.scenario->setpointC;
+        if(!Sim.inBand)
+        {
+            /* The Band Is Scored Once The Tank First Reached It Or The Warm Up Time Is Over */
+            if((errorC > -Sim.scenario->bandC && errorC < Sim.scenario->bandC) || cycles >= Sim_Cycles(SIM_WARM_UP_S))
+            {
+                Sim.inBand = 1;
+                Sim.result.settleS = (f64)cycles / (f64)HW_SIM_CYCLES_PER_SECOND;
+            }
+            else
+            {
+                /* Empty Else To Satisfy The Misra Rules */
+            }
+        }
+        else
+        {
+            if(errorC > Sim.result.overshootC)
+            {
+                Sim.result.overshootC = errorC;
+            }
+            if(errorC <= -Sim.scenario->bandC || errorC >= Sim.scenario->bandC)
+            {
+                Sim.result.outsideBandS += dt;
+            }
+        }
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+#if SCHED_INSTRUMENTATION == STD_ON
+/**
+ * @brief Prints the scheduler statistics of the tasks
+ *
+ */
+static void Sim_ReportTasks(void)
+{
+    schedTaskStats_t stats;
+    uint8_t i;
+    f64 usPerCount = 1e6 / (f64)SCHED_SYS_CLK;
+    printf("late ticks          : %u (%u handled by the overload policy)\n", Sched_GetLateTicks(), Sched_GetOverloadTicks());
+    printf("task               runs      exec min/avg/max (us)    release jitter (us)  missed ticks\n");
+    for(i=0; i<sizeof(Sim_tasks) / sizeof(Sim_tasks[0]); i++)
+    {
+        if(Sched_GetTaskStats(Sim_tasks[i].task, &stats) == E_OK)
+        {
+            printf("%-16s %8lu  %7.1f/%7.1f/%7.1f  %19.1f  %12u\n", Sim_tasks[i].name, (unsigned long)stats.runs,
+                   stats.minExecCounts * usPerCount, stats.avgExecCounts * usPerCount, stats.maxExecCounts * usPerCount,
+                   (stats.maxReleaseCounts - stats.minReleaseCounts) * usPerCount, stats.missedTicks);
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+}
+#endif
+
+#if SCHED_CPU_LOAD == STD_ON
+/**
+ * @brief Prints the CPU load measured by the scheduler and its busy time histogram
+ *
+ */
+static void Sim_ReportCpuLoad(void)
+{
+    schedCpuLoad_t load;
+    uint8_t i;
+    Sched_GetCpuLoad(&load);
+    printf("cpu load            : %.1f %% (peak %.1f %% of a tick in the last %u ms)\n", load.loadPermille / 10.0,
+           load.peakPermille / 10.0, SCHED_LOAD_WINDOW_MS);
+    printf("busy per wake-up    :");
+    for(i=0; i<SCHED_LOAD_BUCKETS; i++)
+    {
+        printf(" %u%s", load.histogram[i], (i + 1 < SCHED_LOAD_BUCKETS) ? "" : "+");
+    }
+    printf(" (%u %% of a tick per bucket)\n", 100 / SCHED_LOAD_BUCKETS);
+}
+#endif
+
+/**
+ * @brief Finds the newest intact settings record in the simulated EEPROM, with a bit by bit CRC
+ *        instead of the table of the firmware
+ *
+ * @param record The record
+ * @return uint8_t 1 if there is an intact record
+ */
+static uint8_t Sim_GetSettingsRecord(uint8_t* record)
+{
+    uint8_t found = 0;
+    uint8_t slot[SETTINGS_RECORD_SIZE];
+    uint16_t newest = 0;
+    uint16_t sequence;
+    uint8_t crc;
+    uint16_t i;
+    uint8_t j;
+    uint8_t bit;
+    for(i=0; i<SETTINGS_NUMBER_OF_SLOTS; i++)
+    {
+        crc = SIM_CRC_INITIAL;
+        for(j=0; j<SETTINGS_RECORD_SIZE; j++)
+        {
+            slot[j] = HwSim_GetEepromByte((uint16_t)(SETTINGS_REGION_ADDRESS + i * SETTINGS_SLOT_SIZE + j));
+            if(j < SETTINGS_RECORD_SIZE - 1)
+            {
+                crc ^= slot[j];
+                for(bit=0; bit<8; bit++)
+                {
+                    crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ SIM_CRC_POLYNOMIAL) : (uint8_t)(crc << 1);
+                }
+            }
+        }
+        sequence = (uint16_t)((slot[SIM_RECORD_SEQUENCE] << 8) | slot[SIM_RECORD_SEQUENCE + 1]);
+        /* The Runs Are Too Short For The Sequence Numbers To Go Round */
+        if(SIM_RECORD_ERASED != sequence && (crc ^ SIM_CRC_FINAL) == slot[SETTINGS_RECORD_SIZE - 1] && (!found || sequence > newest))
+        {
+            memcpy(record, slot, sizeof(slot));
+            newest = sequence;
+            found = 1;
+        }
+    }
+    return found;
+}
+
+/**
+ * @brief Prints the setpoint of the newest settings record and checks it is the entered one
+ *
+ * @return uint8_t 1 if the entered setpoint is saved, or it is the initial one and nothing was saved
+ */
+static uint8_t Sim_ReportSettings(void)
+{
+    uint8_t record[SETTINGS_RECORD_SIZE];
+    uint8_t saved = 0;
+    if(Sim_GetSettingsRecord(record))
+    {
+        saved = (record[SIM_RECORD_VALUES + WATER_HEATER_SETPOINT_SETTING] == Sim.enteredC);
+        printf("saved setpoint      : %u C (record %u, %u refused writes)%s\n", record[SIM_RECORD_VALUES + WATER_HEATER_SETPOINT_SETTING],
+               (record[SIM_RECORD_SEQUENCE] << 8) | record[SIM_RECORD_SEQUENCE + 1], Sim.scenario->eepromWriteFaults,
+               saved ? "" : " NOT THE ENTERED ONE");
+    }
+    else
+    {
+        saved = (SIM_INITIAL_SETPOINT_C == Sim.enteredC);
+        printf("saved setpoint      : none%s\n", saved ? " (the initial one is kept)" : " NOT SAVED");
+    }
+    return saved;
+}
+
+/**
+ * @brief Checks the elements did not switch more often than the configured rate
+ *
+ * @param result The results
+ * @return uint8_t 1 if the number of switches is within the bound
+ */
+static uint8_t Sim_CheckSwitches(const simResult_t* result)
+{
+    f64 allowed = SIM_MAX_SWITCHES_PER_DAY * result->simulatedS / SIM_SECONDS_PER_DAY + SIM_SWITCHES_ALLOWANCE;
+    uint8_t bounded = ((f64)(result->heaterSwitches + result->coolerSwitches) <= allowed);
+    if(!bounded)
+    {
+        printf("element switches    : %u, MORE THAN THE %.0f ALLOWED\n", result->heaterSwitches + result->coolerSwitches, allowed);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return bounded;
+}
+
+/**
+ * @brief Prints the results and ends the process
+ *
+ */
+static void Sim_Report(void)
+{
+    simResult_t result;
+    uint8_t passed;
+    f64 wallS = (f64)(clock() - Sim_wallStart) / (f64)CLOCKS_PER_SEC;
+    Sim_GetResult(&result);
+    printf("simulated time      : %.1f s (%.3f s wall, %.0fx real time)\n", result.simulatedS, wallS, wallS > 0.0 ? result.simulatedS / wallS : 0.0);
+    printf("setpoint            : %u C (band +/- %.1f C)\n", Sim.scenario->setpointC, Sim.scenario->bandC);
+    printf("tank temperature    : %.2f C (min %.2f, max %.2f)\n", result.finalC, result.minC, result.maxC);
+    printf("scored from         : %.1f s\n", result.settleS);
+    printf("overshoot           : %.2f C\n", result.overshootC);
+    printf("outside band        : %.1f s\n", result.outsideBandS);
+    printf("heater energy       : %.3f kWh (%u switches)\n", result.heaterKWh, result.heaterSwitches);
+    printf("cooler energy       : %.3f kWh (%u switches)\n", result.coolerKWh, result.coolerSwitches);
+    printf("water drawn         : %.1f L\n", result.drawnL);
+    printf("controller idle     : %.2f %% (%.2f %% asleep, %llu wake-ups)\n", result.idlePercent, result.sleepPercent,
+           (unsigned long long)result.wakeUps);
+    printf("watchdog            : %.1f ms longest clear gap (%u time outs)\n", result.watchdogGapMS, result.watchdogTimeouts);
+#if SCHED_CPU_LOAD == STD_ON
+    Sim_ReportCpuLoad();
+#endif
+#if SCHED_INSTRUMENTATION == STD_ON
+    Sim_ReportTasks();
+#endif
+    passed = Sim_CheckSwitches(&result);
+    passed &= Sim_ReportSettings();
+    exit(passed ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+/**
+ * @brief Fills a scenario with the defaults
+ *
+ * @param scenario The scenario
+ */
+void Sim_GetDefaults(simScenario_t* scenario)
+{
+    memset(scenario, 0, sizeof(*scenario));
+    scenario->runTimeS = SIM_SECONDS_PER_DAY;
+    scenario->setpointC = SIM_INITIAL_SETPOINT_C;
+    scenario->bandC = SIM_DEFAULT_BAND_C;
+    Plant_GetDefaults(&scenario->plant);
+    WaterHeater_GetDefaultTuning(&scenario->tuning);
+}
+
+/**
+ * @brief Builds the default scenario from the command line and starts it, the results are printed at the end
+ *
+ * @param argc The number of arguments
+ * @param argv The arguments
+ */
+void Sim_Init(int argc, char* argv[])
+{
+    int i;
+    Sim_GetDefaults(&Sim_scenario);
+    for(i=1; i<argc; i++)
+    {
+        if(i + 1 < argc && strcmp(argv[i], "-t") == 0)
+        {
+            Sim_scenario.runTimeS = atof(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-d") == 0)
+        {
+            Sim_scenario.runTimeS = atof(argv[++i]) * SIM_SECONDS_PER_DAY;
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-s") == 0)
+        {
+            Sim_scenario.setpointC = (uint8_t)atoi(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-i") == 0)
+        {
+            Sim_scenario.plant.initialC = atof(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-r") == 0)
+        {
+            Sim_scenario.tuning.changeRate = (uint8_t)atoi(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-n") == 0)
+        {
+            Sim_scenario.tuning.numberOfReadings = (uint8_t)atoi(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-c") == 0)
+        {
+            Sim_scenario.tuning.controlFeature = (uint8_t)atoi(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-p") == 0)
+        {
+            Sim_scenario.mainTaskPeriodMS = (uint32_t)atoi(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-g") == 0)
+        {
+            Sim_scenario.plant.glitchCounts = atof(argv[++i]);
+        }
+        else if(i + 1 < argc && strcmp(argv[i], "-e") == 0)
+        {
+            Sim_scenario.eepromWriteFaults = (uint32_t)atol(argv[++i]);
+        }
+        else
+        {
+            fprintf(stderr, "usage: %s [-t seconds] [-d days] [-s setpoint] [-i initial temperature] [-r change rate] [-n readings] [-c 0|1] [-p task period ms] [-g glitch counts] [-e refused eeprom writes]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+    Sim_wallStart = clock();
+    if(Sim_Start(&Sim_scenario, Sim_Report) != E_OK)
+    {
+        fprintf(stderr, "%s: the tuning or the task period is not valid\n", argv[0]);
+        exit(EXIT_FAILURE);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+}
+
+/**
+ * @brief Resets the simulator, attaches the tank and schedules the button presses of a scenario
+ *
+ * @param scenario The scenario, it must stay valid while the simulation runs
+ * @param stop The handler called when the run time elapses, it must not return
+ * @return Std_ReturnType 
+ *                 E_OK : if the function is executed correctly
+ *                 E_NOT_OK : if the tuning or the task periods are not valid
+ */
+Std_ReturnType Sim_Start(const simScenario_t* scenario, HwSim_Hook_t stop)
+{
+    Std_ReturnType error = E_OK;
+    sint16_t presses;
+    f64 atS = SIM_POWER_ON_PRESS_S;
+    uint8_t button = SIM_UP_BUTTON;
+    memset(&Sim, 0, sizeof(Sim));
+    Sim.scenario = scenario;
+    Sim.result.minC = scenario->plant.initialC;
+    Sim.result.maxC = scenario->plant.initialC;
+    HwSim_Reset();
+    HwSim_SetRunTime(Sim_Cycles(scenario->runTimeS));
+    HwSim_SetStopHandler(stop);
+    HwSim_SetTickHook(Sim_Tick);
+    HwSim_SetEepromWriteFaults(scenario->eepromWriteFaults);
+    Plant_Init(&scenario->plant);
+    /* The Tuning Of This Instance, Applied Before The Scheduler Starts */
+    error |= WaterHeater_SetTuning(&scenario->tuning);
+    if(scenario->mainTaskPeriodMS % SCHED_TICK_TIME_MS || scenario->switchTaskPeriodMS % SCHED_TICK_TIME_MS)
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        error |= Sched_SetPeriodOverride(&WaterHeater_Task, scenario->mainTaskPeriodMS);
+        error |= Sched_SetPeriodOverride(&Switch_task, scenario->switchTaskPeriodMS);
+    }
+    /* Turn The Heater On */
+    Sim_Press(atS, SIM_ON_OFF_BUTTON);
+    /* Enter The Setting Mode And Step To The Setpoint */
+    presses = (sint16_t)(((sint16_t)scenario->setpointC - SIM_INITIAL_SETPOINT_C) / (sint16_t)scenario->tuning.changeRate);
+    Sim.enteredC = (sint16_t)(SIM_INITIAL_SETPOINT_C + presses * (sint16_t)scenario->tuning.changeRate);
+    if(presses < 0)
+    {
+        presses = (sint16_t)-presses;
+        button = SIM_DOWN_BUTTON;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    if(presses > 0)
+    {
+        presses++;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    while(presses-- > 0)
+    {
+        atS += SIM_PRESS_PERIOD_S;
+        Sim_Press(atS, button);
+    }
+    /* Switch The Heater Off And On Again, The Setpoint Is Saved And Loaded */
+    if(scenario->restartAtS > atS)
+    {
+        Sim_Press(scenario->restartAtS, SIM_ON_OFF_BUTTON);
+        Sim_Press(scenario->restartAtS + SIM_PRESS_PERIOD_S, SIM_ON_OFF_BUTTON);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief Gets the results of the running scenario
+ *
+ * @param result The results
+ */
+void Sim_GetResult(simResult_t* result)
+{
+    const plantState_t* plant = Plant_GetState();
+    *result = Sim.result;
+    result->simulatedS = (f64)HwSim_GetCycles() / (f64)HW_SIM_CYCLES_PER_SECOND;
+    result->finalC = plant->temperatureC;
+    result->heaterKWh = plant->heaterJ / 3.6e6;
+    result->coolerKWh = plant->coolerJ / 3.6e6;
+    result->drawnL = plant->drawnL;
+    result->heaterSwitches = plant->heaterSwitches;
+    result->coolerSwitches = plant->coolerSwitches;
+    result->idlePercent = HwSim_GetCycles() ? 100.0 * (f64)HwSim_GetIdleCycles() / (f64)HwSim_GetCycles() : 0.0;
+    result->sleepPercent = HwSim_GetCycles() ? 100.0 * (f64)HwSim_GetSleepCycles() / (f64)HwSim_GetCycles() : 0.0;
+    result->wakeUps = HwSim_GetCompareMatches();
+    result->watchdogGapMS = 1e3 * (f64)HwSim_GetLongestWatchdogGap() / (f64)HW_SIM_CYCLES_PER_SECOND;
+    result->watchdogTimeouts = HwSim_GetWatchdogTimeouts();
+}
+
+#if SCHED_INSTRUMENTATION == STD_ON
+/**
+ * @brief Gets the name of a task of Sched_Cfg.c
+ *
+ * @param task The task
+ * @return const char* The name, "?" if the task is not known
+ */
+const char* Sim_GetTaskName(const task_t* task)
+{
+    const char* name = "?";
+    uint8_t i;
+    for(i=0; i<sizeof(Sim_tasks) / sizeof(Sim_tasks[0]); i++)
+    {
+        if(Sim_tasks[i].task == task)
+        {
+            name = Sim_tasks[i].name;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+    }
+    return name;
+}
+#endif
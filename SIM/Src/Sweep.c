@@ -0,0 +1,422 @@
+/**
+ * @file Sweep.c
+ * @author Mark Attia (markjosephattia@gmail.com)
+ * @brief The parameter sweep of the closed loop simulation, every combination of the tuning runs as an
+ *        independent firmware and tank instance on a work stealing pool and the results are ranked
+ * @version 0.1
+ * @date 2020-07-05
+ *
+ * @copyright Copyright (c) 2020
+ *
+ */
+#define _POSIX_C_SOURCE                   200809L
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "Std_Types.h"
+#include "Hw.h"
+#include "Sched_Cfg.h"
+#include "Sim.h"
+#include "Sweep_Cfg.h"
+
+#define SWEEP_SECONDS_PER_DAY             86400.0
+
+/* The Ranking Keys */
+#define SWEEP_KEY_BAND                    0
+#define SWEEP_KEY_ENERGY                  1
+#define SWEEP_KEY_OVERSHOOT               2
+
+typedef struct
+{
+    simScenario_t scenario;
+    simResult_t result;
+} sweepJob_t;
+
+/* The Jobs Of A Worker, The Owner Pops From The Bottom And The Thieves Steal From The Top */
+typedef struct
+{
+    pthread_mutex_t lock;
+    uint32_t top;
+    uint32_t bottom;
+    uint32_t* jobs;
+} sweepDeque_t;
+
+typedef struct
+{
+    uint32_t values[SWEEP_MAX_VALUES];
+    uint8_t count;
+} sweepList_t;
+
+static sweepJob_t* Sweep_jobs;
+static uint32_t Sweep_numberOfJobs;
+static sweepDeque_t Sweep_deques[SWEEP_MAX_WORKERS];
+static uint8_t Sweep_numberOfWorkers;
+static uint8_t Sweep_key = SWEEP_KEY_BAND;
+static pthread_mutex_t Sweep_progressLock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t Sweep_done;
+
+/* The Job Of The Instance Running On This Thread */
+static HW_INSTANCE sweepJob_t* Sweep_job;
+
+/**
+ * @brief Parses a comma separated list
+ *
+ */
+static Std_ReturnType Sweep_ParseList(const char* text, sweepList_t* list)
+{
+    Std_ReturnType error = E_OK;
+    char* end;
+    list->count = 0;
+    while(error == E_OK && *text)
+    {
+        if(list->count < SWEEP_MAX_VALUES)
+        {
+            list->values[list->count++] = (uint32_t)strtoul(text, &end, 10);
+            if(end == text || (*end != ',' && *end != '\0'))
+            {
+                error = E_NOT_OK;
+            }
+            else
+            {
+                text = (*end == ',') ? end + 1 : end;
+            }
+        }
+        else
+        {
+            error = E_NOT_OK;
+        }
+    }
+    if(list->count == 0)
+    {
+        error = E_NOT_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return error;
+}
+
+/**
+ * @brief The stop handler of every instance, records the results and ends the instance thread
+ *
+ */
+static void Sweep_Stop(void)
+{
+    Sim_GetResult(&Sweep_job->result);
+    pthread_exit(NULL);
+}
+
+/**
+ * @brief Runs one instance, the thread local state of a fresh thread is the power on state
+ *
+ */
+static void* Sweep_Instance(void* job)
+{
+    Sweep_job = (sweepJob_t*)job;
+    if(Sim_Start(&Sweep_job->scenario, Sweep_Stop) == E_OK)
+    {
+        Sched_Init();
+        Sched_Start();
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    return NULL;
+}
+
+/**
+ * @brief Takes a job from the bottom of the worker's own deque or steals one from the top of another deque
+ *
+ */
+static Std_ReturnType Sweep_TakeJob(uint8_t worker, uint32_t* job)
+{
+    Std_ReturnType error = E_NOT_OK;
+    sweepDeque_t* deque = &Sweep_deques[worker];
+    uint8_t i;
+    pthread_mutex_lock(&deque->lock);
+    if(deque->bottom > deque->top)
+    {
+        *job = deque->jobs[--deque->bottom];
+        error = E_OK;
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    pthread_mutex_unlock(&deque->lock);
+    for(i=1; error != E_OK && i<Sweep_numberOfWorkers; i++)
+    {
+        deque = &Sweep_deques[(worker + i) % Sweep_numberOfWorkers];
+        pthread_mutex_lock(&deque->lock);
+        if(deque->bottom > deque->top)
+        {
+            *job = deque->jobs[deque->top++];
+            error = E_OK;
+        }
+        else
+        {
+            /* Empty Else To Satisfy The Misra Rules */
+        }
+        pthread_mutex_unlock(&deque->lock);
+    }
+    return error;
+}
+
+/**
+ * @brief A worker of the pool, every job runs on its own thread so it starts from a fresh instance
+ *
+ */
+static void* Sweep_Worker(void* arg)
+{
+    uint8_t worker = (uint8_t)(uintptr_t)arg;
+    uint32_t job;
+    pthread_t instance;
+    while(Sweep_TakeJob(worker, &job) == E_OK)
+    {
+        if(pthread_create(&instance, NULL, Sweep_Instance, &Sweep_jobs[job]) == 0)
+        {
+            pthread_join(instance, NULL);
+        }
+        else
+        {
+            fprintf(stderr, "sweep: could not start instance %u\n", job);
+        }
+        pthread_mutex_lock(&Sweep_progressLock);
+        Sweep_done++;
+        fprintf(stderr, "\r%u/%u instances", Sweep_done, Sweep_numberOfJobs);
+        pthread_mutex_unlock(&Sweep_progressLock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Orders the results by the ranking key, the other keys break the ties
+ *
+ */
+static int Sweep_Compare(const void* a, const void* b)
+{
+    const simResult_t* x = &((const sweepJob_t*)a)->result;
+    const simResult_t* y = &((const sweepJob_t*)b)->result;
+    f64 keys[2][3] = {
+        {x->outsideBandS, x->heaterKWh + x->coolerKWh, x->overshootC},
+        {y->outsideBandS, y->heaterKWh + y->coolerKWh, y->overshootC}
+    };
+    int order = 0;
+    uint8_t i;
+    for(i=0; order == 0 && i<3; i++)
+    {
+        uint8_t key = (uint8_t)((Sweep_key + i) % 3);
+        order = (keys[0][key] > keys[1][key]) - (keys[0][key] < keys[1][key]);
+    }
+    return order;
+}
+
+/**
+ * @brief Prints the usage and ends the process
+ *
+ */
+static void Sweep_Usage(const char* name)
+{
+    fprintf(stderr,
+        "usage: %s [-d days] [-s setpoint] [-i initial temperature] [-r change rates] [-n readings]\n"
+        "          [-p task periods ms] [-c features] [-j workers] [-k band|energy|overshoot] [-top lines]\n"
+        "       the lists are comma separated, every combination runs as one instance\n", name);
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Builds the grid, runs it on the pool and prints the ranked report
+ *
+ */
+int main(int argc, char* argv[])
+{
+    simScenario_t base;
+    sweepList_t rates;
+    sweepList_t readings;
+    sweepList_t periods;
+    sweepList_t features;
+    pthread_t workers[SWEEP_MAX_WORKERS];
+    struct timespec start;
+    struct timespec end;
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    uint32_t top = SWEEP_DEFAULT_TOP;
+    uint32_t job;
+    uint32_t perWorker;
+    uint8_t r, n, p, c, w;
+    int i;
+    Std_ReturnType error = E_OK;
+    Sim_GetDefaults(&base);
+    base.runTimeS = SWEEP_DEFAULT_DAYS * SWEEP_SECONDS_PER_DAY;
+    error |= Sweep_ParseList(SWEEP_DEFAULT_CHANGE_RATES, &rates);
+    error |= Sweep_ParseList(SWEEP_DEFAULT_READINGS, &readings);
+    error |= Sweep_ParseList(SWEEP_DEFAULT_PERIODS_MS, &periods);
+    error |= Sweep_ParseList(SWEEP_DEFAULT_FEATURES, &features);
+    Sweep_numberOfWorkers = (uint8_t)((processors < 1) ? 1 : (processors > SWEEP_MAX_WORKERS) ? SWEEP_MAX_WORKERS : processors);
+    for(i=1; error == E_OK && i<argc; i++)
+    {
+        if(i + 1 >= argc)
+        {
+            error = E_NOT_OK;
+        }
+        else if(strcmp(argv[i], "-d") == 0)
+        {
+            base.runTimeS = atof(argv[++i]) * SWEEP_SECONDS_PER_DAY;
+        }
+        else if(strcmp(argv[i], "-s") == 0)
+        {
+            base.setpointC = (uint8_t)atoi(argv[++i]);
+        }
+        else if(strcmp(argv[i], "-i") == 0)
+        {
+            base.plant.initialC = atof(argv[++i]);
+        }
+        else if(strcmp(argv[i], "-r") == 0)
+        {
+            error = Sweep_ParseList(argv[++i], &rates);
+        }
+        else if(strcmp(argv[i], "-n") == 0)
+        {
+            error = Sweep_ParseList(argv[++i], &readings);
+        }
+        else if(strcmp(argv[i], "-p") == 0)
+        {
+            error = Sweep_ParseList(argv[++i], &periods);
+        }
+        else if(strcmp(argv[i], "-c") == 0)
+        {
+            error = Sweep_ParseList(argv[++i], &features);
+        }
+        else if(strcmp(argv[i], "-j") == 0)
+        {
+            w = (uint8_t)atoi(argv[++i]);
+            Sweep_numberOfWorkers = (w < 1) ? 1 : (w > SWEEP_MAX_WORKERS) ? SWEEP_MAX_WORKERS : w;
+        }
+        else if(strcmp(argv[i], "-k") == 0)
+        {
+            i++;
+            if(strcmp(argv[i], "band") == 0)
+            {
+                Sweep_key = SWEEP_KEY_BAND;
+            }
+            else if(strcmp(argv[i], "energy") == 0)
+            {
+                Sweep_key = SWEEP_KEY_ENERGY;
+            }
+            else if(strcmp(argv[i], "overshoot") == 0)
+            {
+                Sweep_key = SWEEP_KEY_OVERSHOOT;
+            }
+            else
+            {
+                error = E_NOT_OK;
+            }
+        }
+        else if(strcmp(argv[i], "-top") == 0)
+        {
+            top = (uint32_t)atoi(argv[++i]);
+        }
+        else
+        {
+            error = E_NOT_OK;
+        }
+    }
+    if(error != E_OK)
+    {
+        Sweep_Usage(argv[0]);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    /* Build The Grid */
+    Sweep_numberOfJobs = (uint32_t)rates.count * readings.count * periods.count * features.count;
+    Sweep_jobs = calloc(Sweep_numberOfJobs, sizeof(sweepJob_t));
+    if(Sweep_jobs == NULL)
+    {
+        fprintf(stderr, "sweep: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+    else
+    {
+        /* Empty Else To Satisfy The Misra Rules */
+    }
+    job = 0;
+    for(r=0; r<rates.count; r++)
+    {
+        for(n=0; n<readings.count; n++)
+        {
+            for(p=0; p<periods.count; p++)
+            {
+                for(c=0; c<features.count; c++)
+                {
+                    Sweep_jobs[job].scenario = base;
+                    Sweep_jobs[job].scenario.tuning.changeRate = (uint8_t)rates.values[r];
+                    Sweep_jobs[job].scenario.tuning.numberOfReadings = (uint8_t)readings.values[n];
+                    Sweep_jobs[job].scenario.tuning.controlFeature = (uint8_t)features.values[c];
+                    Sweep_jobs[job].scenario.mainTaskPeriodMS = periods.values[p];
+                    if(rates.values[r] == 0 || rates.values[r] > 0xFF || readings.values[n] == 0
+                        || readings.values[n] > WATER_HEATER_MAX_NUMBER_OF_READINGS || periods.values[p] % SCHED_TICK_TIME_MS)
+                    {
+                        fprintf(stderr, "sweep: change rate %u, %u readings or task period %u ms is not valid\n",
+                                rates.values[r], readings.values[n], periods.values[p]);
+                        exit(EXIT_FAILURE);
+                    }
+                    else
+                    {
+                        /* Empty Else To Satisfy The Misra Rules */
+                    }
+                    job++;
+                }
+            }
+        }
+    }
+    /* Deal The Jobs In Contiguous Blocks, The Idle Workers Steal The Rest */
+    perWorker = (Sweep_numberOfJobs + Sweep_numberOfWorkers - 1) / Sweep_numberOfWorkers;
+    for(w=0; w<Sweep_numberOfWorkers; w++)
+    {
+        pthread_mutex_init(&Sweep_deques[w].lock, NULL);
+        Sweep_deques[w].jobs = malloc(perWorker * sizeof(uint32_t));
+        Sweep_deques[w].top = 0;
+        Sweep_deques[w].bottom = 0;
+        for(job=w*perWorker; job<Sweep_numberOfJobs && job<(w+1)*perWorker; job++)
+        {
+            Sweep_deques[w].jobs[Sweep_deques[w].bottom++] = job;
+        }
+    }
+    fprintf(stderr, "%u instances of %.1f days on %u workers\n", Sweep_numberOfJobs, base.runTimeS / SWEEP_SECONDS_PER_DAY, Sweep_numberOfWorkers);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for(w=0; w<Sweep_numberOfWorkers; w++)
+    {
+        pthread_create(&workers[w], NULL, Sweep_Worker, (void*)(uintptr_t)w);
+    }
+    for(w=0; w<Sweep_numberOfWorkers; w++)
+    {
+        pthread_join(workers[w], NULL);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    fprintf(stderr, "\n%.1f s wall\n", (f64)(end.tv_sec - start.tv_sec) + (f64)(end.tv_nsec - start.tv_nsec) / 1e9);
+    /* The Ranked Report */
+    qsort(Sweep_jobs, Sweep_numberOfJobs, sizeof(sweepJob_t), Sweep_Compare);
+    printf("rank  rate  readings  period  feature  outside band (h)  energy (kWh)  overshoot (C)  final (C)  switches\n");
+    for(job=0; job<Sweep_numberOfJobs && (top == 0 || job<top); job++)
+    {
+        const sweepJob_t* item = &Sweep_jobs[job];
+        printf("%4u  %4u  %8u  %6u  %7u  %16.2f  %12.3f  %13.2f  %9.2f  %8u\n", job + 1,
+               item->scenario.tuning.changeRate, item->scenario.tuning.numberOfReadings,
+               item->scenario.mainTaskPeriodMS, item->scenario.tuning.controlFeature,
+               item->result.outsideBandS / 3600.0, item->result.heaterKWh + item->result.coolerKWh,
+               item->result.overshootC, item->result.finalC,
+               item->result.heaterSwitches + item->result.coolerSwitches);
+    }
+    for(w=0; w<Sweep_numberOfWorkers; w++)
+    {
+        free(Sweep_deques[w].jobs);
+    }
+    free(Sweep_jobs);
+    return EXIT_SUCCESS;
+}
@@ -3,6 +3,18 @@
 #include "Sched.h"
 #define _XTAL_FREQ 8000000
 
+#ifdef HW_HOST
+#include "Sim.h"
+
+int main(int argc, char* argv[])
+{
+    /* The Simulated Register File And Tank Must Be Ready Before Any Driver Touches Them */
+    Sim_Init(argc, argv);
+    Sched_Init();
+    Sched_Start();
+    return 0;
+}
+#else
 void main(void) 
 {
     Sched_Init();
@@ -10,3 +22,4 @@ void main(void)
     while(1);
     return;
 }
+#endif